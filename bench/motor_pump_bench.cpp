@@ -0,0 +1,171 @@
+/**
+ * @file
+ * @brief Benchmark of the motor and pump (PSAT) calculations
+ *
+ * Times the motor calculators and PSATResult over all efficiency classes, pole counts and pump styles, with inputs
+ * taken from the cases of tests/Results.unit.cpp, tests/MotorEfficiency.unit.cpp and tests/MotorCurrent.unit.cpp.
+ * Every workload cycles through its cases until the minimum time has passed and reports ns/call and calls/s, so
+ * builds can be compared release to release on the same machine.
+ *
+ * Usage: motor_pump_bench [seconds per workload, default 0.5]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+#include <calculator/motor/MotorEfficiency.h>
+#include <calculator/motor/MotorCurrent.h>
+#include <calculator/motor/MotorShaftPower.h>
+#include <calculator/motor/OptimalMotorPower.h>
+#include <results/Results.h>
+
+namespace {
+    /// results are accumulated here so the calls are not optimized away
+    volatile double sink = 0;
+
+    const Motor::EfficiencyClass efficiencyClasses[] = {
+            Motor::EfficiencyClass::STANDARD, Motor::EfficiencyClass::ENERGY_EFFICIENT,
+            Motor::EfficiencyClass::PREMIUM, Motor::EfficiencyClass::SPECIFIED
+    };
+
+    /// 2, 4, 6, 8, 10 and 12 pole speeds at 60 Hz and 50 Hz, each within the speed range Poles maps to that pole count
+    struct Speed {
+        Motor::LineFrequency lineFrequency;
+        double rpm;
+    };
+    const Speed speeds[] = {
+            {Motor::LineFrequency::FREQ60, 3560}, {Motor::LineFrequency::FREQ60, 1785},
+            {Motor::LineFrequency::FREQ60, 1180}, {Motor::LineFrequency::FREQ60, 885},
+            {Motor::LineFrequency::FREQ60, 705}, {Motor::LineFrequency::FREQ60, 585},
+            {Motor::LineFrequency::FREQ50, 2985}, {Motor::LineFrequency::FREQ50, 1500},
+            {Motor::LineFrequency::FREQ50, 985}, {Motor::LineFrequency::FREQ50, 740},
+            {Motor::LineFrequency::FREQ50, 590}, {Motor::LineFrequency::FREQ50, 490}
+    };
+
+    const double ratedPowers[] = {100, 200, 500};
+    const double loadFactors[] = {0.25, 0.5, 0.75, 1, 1.25};
+
+    const Pump::Style pumpStyles[] = {
+            Pump::Style::END_SUCTION_SLURRY, Pump::Style::END_SUCTION_SEWAGE, Pump::Style::END_SUCTION_STOCK,
+            Pump::Style::END_SUCTION_SUBMERSIBLE_SEWAGE, Pump::Style::API_DOUBLE_SUCTION,
+            Pump::Style::MULTISTAGE_BOILER_FEED, Pump::Style::END_SUCTION_ANSI_API, Pump::Style::AXIAL_FLOW,
+            Pump::Style::DOUBLE_SUCTION, Pump::Style::VERTICAL_TURBINE, Pump::Style::LARGE_END_SUCTION,
+            Pump::Style::SPECIFIED_OPTIMAL_EFFICIENCY
+    };
+
+    /**
+     * Calls run(i) for i cycling through 0 .. caseCount - 1 until seconds have passed, and prints the timing
+     * @param name std::string, name of the workload
+     * @param caseCount std::size_t, number of cases
+     * @param seconds double, minimum time to run in s
+     * @param run std::function<double(std::size_t)>, evaluates case i and returns a result
+     */
+    void measure(const std::string &name, const std::size_t caseCount, const double seconds,
+                 const std::function<double(std::size_t)> &run) {
+        typedef std::chrono::steady_clock Clock;
+        std::size_t calls = 0;
+        double elapsed = 0;
+        auto const start = Clock::now();
+        do {
+            double sum = 0;
+            for (std::size_t i = 0; i < caseCount; ++i) {
+                sum += run(i);
+            }
+            sink = sink + sum;
+            calls += caseCount;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (elapsed < seconds);
+
+        std::printf("%-40s %8zu cases %12.1f ns/call %14.0f calls/s\n", name.c_str(), caseCount,
+                    elapsed * 1e9 / calls, calls / elapsed);
+    }
+
+    struct MotorCase {
+        Motor::LineFrequency lineFrequency;
+        double rpm;
+        Motor::EfficiencyClass efficiencyClass;
+        double ratedPower, specifiedEfficiency, loadFactor;
+    };
+
+    std::vector<MotorCase> motorCases() {
+        std::vector<MotorCase> cases;
+        for (auto const efficiencyClass : efficiencyClasses) {
+            for (auto const & speed : speeds) {
+                for (auto const ratedPower : ratedPowers) {
+                    for (auto const loadFactor : loadFactors) {
+                        cases.push_back({speed.lineFrequency, speed.rpm, efficiencyClass, ratedPower, 95, loadFactor});
+                    }
+                }
+            }
+        }
+        return cases;
+    }
+
+    /// The Results.unit.cpp pump at 200 hp, 80 kW measured, in every pump style and motor efficiency class
+    std::vector<PSATResult> psatCases(const Motor::LoadEstimationMethod loadEstimationMethod) {
+        std::vector<PSATResult> cases;
+        for (auto const style : pumpStyles) {
+            for (auto const efficiencyClass : efficiencyClasses) {
+                for (auto const & speed : speeds) {
+                    Pump::Input const pump(style, 0.80, 1780, Motor::Drive::DIRECT_DRIVE, 1.0, 1.0, 2.0,
+                                           Pump::SpecificSpeed::NOT_FIXED_SPEED, 1.0);
+                    Motor const motor(speed.lineFrequency, 200, speed.rpm, efficiencyClass, 95, 460, 225.0, 0);
+                    Pump::FieldData const fieldData(1840, 174.85, loadEstimationMethod, 80, 125.857, 480);
+                    cases.emplace_back(pump, motor, fieldData, 8760, 0.05);
+                }
+            }
+        }
+        return cases;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    double const seconds = argc > 1 ? std::atof(argv[1]) : 0.5;
+    auto const motors = motorCases();
+
+    measure("MotorEfficiency::calculate", motors.size(), seconds, [&](std::size_t i) {
+        auto const & m = motors[i];
+        return MotorEfficiency(m.lineFrequency, m.rpm, m.efficiencyClass, m.ratedPower)
+                .calculate(m.loadFactor, m.specifiedEfficiency);
+    });
+
+    measure("MotorCurrent::calculateCurrent", motors.size(), seconds, [&](std::size_t i) {
+        auto const & m = motors[i];
+        return MotorCurrent(m.ratedPower, m.rpm, m.lineFrequency, m.efficiencyClass, m.specifiedEfficiency,
+                            m.loadFactor, 460).calculateCurrent(m.ratedPower * 1.15);
+    });
+
+    for (auto const method : {Motor::LoadEstimationMethod::POWER, Motor::LoadEstimationMethod::CURRENT}) {
+        std::string const name = method == Motor::LoadEstimationMethod::POWER ? "POWER" : "CURRENT";
+        measure("MotorShaftPower::calculate " + name, motors.size(), seconds, [&](std::size_t i) {
+            auto const & m = motors[i];
+            // measured power and current at the case's load factor, roughly
+            double const power = m.ratedPower * 0.746 * m.loadFactor / 0.94;
+            double const current = m.ratedPower * 1.15 * (0.3 + 0.7 * m.loadFactor);
+            return MotorShaftPower(m.ratedPower, power, m.rpm, m.lineFrequency, m.efficiencyClass,
+                                   m.specifiedEfficiency, 460, m.ratedPower * 1.15, 460, method, current)
+                    .calculate().shaftPower;
+        });
+    }
+
+    measure("OptimalMotorPower::calculate", motors.size(), seconds, [&](std::size_t i) {
+        auto const & m = motors[i];
+        return OptimalMotorPower(m.ratedPower, m.rpm, m.lineFrequency, m.efficiencyClass, m.specifiedEfficiency, 460,
+                                 460, m.ratedPower * m.loadFactor).calculate().power;
+    });
+
+    for (auto const method : {Motor::LoadEstimationMethod::POWER, Motor::LoadEstimationMethod::CURRENT}) {
+        std::string const name = method == Motor::LoadEstimationMethod::POWER ? "POWER" : "CURRENT";
+        auto cases = psatCases(method);
+        measure("PSATResult::calculateExisting " + name, cases.size(), seconds, [&](std::size_t i) {
+            return cases[i].calculateExisting().motorPower;
+        });
+        measure("PSATResult::calculateModified " + name, cases.size(), seconds, [&](std::size_t i) {
+            return cases[i].calculateModified().motorPower;
+        });
+    }
+    return 0;
+}
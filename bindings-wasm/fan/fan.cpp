@@ -142,7 +142,9 @@ EMSCRIPTEN_BINDINGS(plane_results)
         .property("flowTraverse", &PlaneData::NodeBinding::Output::flowTraverse)
         .property("inletMstPlane", &PlaneData::NodeBinding::Output::inletMstPlane)
         .property("outletMstPlane", &PlaneData::NodeBinding::Output::outletMstPlane)
-        .property("addlTravPlanes", &PlaneData::NodeBinding::Output::addlTravPlanes);
+        .property("addlTravPlanes", &PlaneData::NodeBinding::Output::addlTravPlanes)
+        .property("fanInletFlangeIterations", &PlaneData::NodeBinding::Output::fanInletFlangeIterations)
+        .property("fanOrEvaseOutletFlangeIterations", &PlaneData::NodeBinding::Output::fanOrEvaseOutletFlangeIterations);
 }
 
 //optimalFanEfficiency
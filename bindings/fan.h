@@ -712,6 +712,8 @@ NAN_METHOD(getPlaneResults)
 		setData(output.flowTraverse, "FlowTraverse");
 		setData(output.inletMstPlane, "InletMstPlane");
 		setData(output.outletMstPlane, "OutletMstPlane");
+		Nan::Set(rv, Nan::New<String>("FanInletFlangeIterations").ToLocalChecked(), Nan::New<Number>(output.fanInletFlangeIterations));
+		Nan::Set(rv, Nan::New<String>("FanOrEvaseOutletFlangeIterations").ToLocalChecked(), Nan::New<Number>(output.fanOrEvaseOutletFlangeIterations));
 	}
 	catch (std::runtime_error const &e)
 	{
@@ -10,6 +10,7 @@
 #ifndef AMO_LIBRARY_MOTORCURRENT_H
 #define AMO_LIBRARY_MOTORCURRENT_H
 
+#include <array>
 #include <results/InputData.h>
 
 class MotorCurrent {
@@ -41,6 +42,14 @@ public:
      */
     double calculateCurrent(double fullLoadAmps);
 
+    /**
+     * calculates the motor current at 0% to 125% load factor in 25% intervals, adjusted to the rated voltage and
+     * the specified full load amps; calculateCurrent() fits its curve to these values. Sets the estimated FLA.
+     * @param fullLoadAmps double, Current at full load in Amps
+     * @return std::array<double, 6>, motor current in amps at 25% intervals
+     */
+    std::array<double, 6> calculatePartLoadCurrents(double fullLoadAmps);
+
 	/**
 	 * calculates the optimal motor current
 	 * @return double, optimal motor current in amps
@@ -0,0 +1,155 @@
+/**
+ * @brief Header file for MotorCurveSet class
+ *
+ * This contains the prototypes of the precomputed motor part load curves.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_LIBRARY_MOTORCURVESET_H
+#define AMO_LIBRARY_MOTORCURVESET_H
+
+#include <array>
+#include <results/InputData.h>
+
+/**
+ * Efficiency, current and power factor curves of one motor.
+ *
+ * MotorEfficiency, MotorCurrent and MotorPowerFactor derive their 25% interval values and polynomial fits from the
+ * motor nameplate data each time they are evaluated at a load factor. A MotorCurveSet does that once: it caches the
+ * 25% interval arrays and the fit coefficients of every load range, so each load factor evaluation is a few
+ * multiply-adds. Results are the same as those of the single point calculators.
+ */
+class MotorCurveSet {
+public:
+    /**
+     * Constructor
+     * @param lineFrequency Motor::LineFrequency, classification of line frequency in Hz
+     * @param motorRpm double, RPM of motor
+     * @param efficiencyClass Motor::EfficiencyClass, classification of motor efficiency
+     * @param motorRatedPower double, rated power of motor in hp
+     * @param specifiedEfficiency double, efficiency of SPECIFIED efficiency class motor as %
+     * @param ratedVoltage double, rated voltage of motor in volts
+     * @param fullLoadAmps double, current at full load in amps, only used by current(); optimalCurrent() is based on
+     *        the estimated FLA
+     * @throws std::runtime_error if the efficiency class is SPECIFIED and no efficiency is specified
+     */
+    MotorCurveSet(Motor::LineFrequency lineFrequency, double motorRpm, Motor::EfficiencyClass efficiencyClass,
+                  double motorRatedPower, double specifiedEfficiency, double ratedVoltage, double fullLoadAmps);
+
+    /**
+     * Motor efficiency, same as MotorEfficiency::calculate
+     * @param loadFactor double, load factor - unitless ratio, capped at 1.5
+     * @return double, motor efficiency as fraction
+     */
+    double efficiency(double loadFactor) const;
+
+    /**
+     * Motor current adjusted to the full load amps, same as MotorCurrent::calculateCurrent
+     * @param loadFactor double, load factor - unitless ratio, capped at 1.5
+     * @return double, motor current in amps
+     */
+    double current(double loadFactor) const;
+
+    /**
+     * Motor current of the estimated FLA at 460 V, same as MotorCurrent::calculateOptimalCurrent
+     * @param loadFactor double, load factor - unitless ratio, capped at 1.5
+     * @return double, motor current in amps
+     */
+    double optimalCurrent(double loadFactor) const;
+
+    /**
+     * Motor power factor, same as MotorPowerFactor::calculate
+     * @param loadFactor double, load factor - unitless ratio
+     * @param current double, motor current at loadFactor in amps
+     * @param efficiency double, motor efficiency at loadFactor as fraction
+     * @param voltage double, voltage the current is measured at in volts
+     * @return double, power factor - unitless
+     */
+    double powerFactor(double loadFactor, double current, double efficiency, double voltage) const;
+
+    /**
+     * @return std::array<double, 5>, motor efficiency at 25% to 125% load factor
+     */
+    const std::array<double, 5> & getEfficiency25intervals() const { return efficiency25intervals; }
+
+    /**
+     * @return std::array<double, 6>, motor current adjusted to the full load amps at 0% to 125% load factor
+     */
+    const std::array<double, 6> & getCurrent25intervals() const { return current25intervals; }
+
+    /**
+     * @return std::array<double, 6>, motor current of the estimated FLA at 0% to 125% load factor
+     */
+    const std::array<double, 6> & getOptimalCurrent25intervals() const { return optimalCurrent25intervals; }
+
+    /**
+     * Load fractions 0, 0.01, 0.02, ... summed in 0.01 steps, the same values the 1% load stepping of MotorShaftPower
+     * and OptimalMotorPower produces, up to and including the first step beyond 1.5
+     * @return std::array<double, 151>, load fractions - unitless
+     */
+    static const std::array<double, 151> & getLoadSteps();
+
+    /**
+     * Finds the first load step at or after first at which reached is true, by bisection. reached(i) must be false
+     * up to some step and true from then on, and true for the last step.
+     * @param first std::size_t, index of the first load step to consider
+     * @param reached callable taking a load step index and returning bool
+     * @return std::size_t, index of the first load step reached
+     */
+    template <class Reached>
+    static std::size_t bisectLoadSteps(std::size_t first, Reached reached) {
+        std::size_t last = getLoadSteps().size() - 1;
+        while (first < last) {
+            std::size_t const middle = first + (last - first) / 2;
+            if (reached(middle)) {
+                last = middle;
+            } else {
+                first = middle + 1;
+            }
+        }
+        return first;
+    }
+
+    double getEstimatedFLA() const { return estimatedFLA; }
+    double getKWloss0() const { return kWloss0; }
+
+    Motor::LineFrequency getLineFrequency() const { return lineFrequency; }
+    double getMotorRpm() const { return motorRpm; }
+    Motor::EfficiencyClass getEfficiencyClass() const { return efficiencyClass; }
+    double getMotorRatedPower() const { return motorRatedPower; }
+    double getSpecifiedEfficiency() const { return specifiedEfficiency; }
+    double getRatedVoltage() const { return ratedVoltage; }
+    double getFullLoadAmps() const { return fullLoadAmps; }
+
+private:
+    /**
+     * Fit coefficients of a curve given by its 0% to 125% values: 2nd order over 0-25%, 4th order over 25-125% and
+     * 2nd order over 125-150% load factor
+     */
+    struct PartLoadFit {
+        std::array<double, 3> low;
+        std::array<double, 5> mid;
+        std::array<double, 3> high;
+    };
+
+    static PartLoadFit fit(const std::array<double, 6> &values);
+    static double evaluate(const PartLoadFit &fit, double loadFactor);
+
+    Motor::LineFrequency lineFrequency;
+    double motorRpm;
+    Motor::EfficiencyClass efficiencyClass;
+    double motorRatedPower, specifiedEfficiency, ratedVoltage, fullLoadAmps;
+
+    std::array<double, 5> efficiency25intervals;
+    std::array<double, 6> current25intervals, optimalCurrent25intervals;
+    double estimatedFLA;
+    double kWloss0, kWloss25;
+
+    std::array<double, 5> efficiencyMid;
+    std::array<double, 3> efficiencyHigh;
+    PartLoadFit currentFit, optimalCurrentFit;
+};
+
+#endif //AMO_LIBRARY_MOTORCURVESET_H
@@ -45,6 +45,14 @@ public:
      */
     double calculate(double loadFactor, double specifiedEfficiency = -1);
 
+    /**
+     * Calculates the 25% interval efficiencies calculate() fits its curve to; for the SPECIFIED class these are the
+     * nearer of the EE and SE intervals scaled to the specified efficiency
+     * @param specifiedEfficiency, efficiency of SPECIFIED efficiency class motor (optional)
+     * @return std::array<double, 5> containing motor efficiency at 25% to 125% load factor
+     */
+    std::array<double, 5> calculateClass25intervals(double specifiedEfficiency = -1) const;
+
     /**
      * calculate25intervals(): Calculates the motor efficiency given at 25% intervals of load factor.
      * @return std::array<double, 5> containing motor efficiency at 25% intervals of load factor
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @brief Replacement assessment of a fleet of installed motors against the motor catalog
+ *
+ * This contains the prototypes of the MotorFleetAnalyzer, which ranks the MotorData catalog motors that can replace
+ * each installed motor by their annual savings.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_LIBRARY_MOTORFLEETANALYZER_H
+#define AMO_LIBRARY_MOTORFLEETANALYZER_H
+
+#include <utility>
+#include <vector>
+#include <results/InputData.h>
+#include "MotorCurveSet.h"
+#include "MotorData.h"
+
+/**
+ * Evaluates the annual energy use of installed motors over their load profiles and the savings of replacing each with
+ * every suitable motor of a MotorData catalog.
+ *
+ * A catalog motor is a candidate replacement of an installed motor if it has the same line frequency and number of
+ * poles, a voltage limit no lower than the installed rated voltage, and a rated power no lower than the OptimalMotorSize
+ * of the installed motor's peak shaft power. Candidates run at the installed motor's shaft power at every load profile
+ * point, with the efficiency curve of a SPECIFIED efficiency class motor of the catalog nominal efficiency.
+ *
+ * The candidate MotorCurveSets are calculated once, when the analyzer is constructed, and shared by all installed
+ * motors; installed motors are evaluated in parallel over a number of threads.
+ */
+class MotorFleetAnalyzer {
+public:
+    /// One point of a load profile
+    struct LoadPoint {
+        /// motor load factor - unitless, shaft power over rated power
+        double loadFactor;
+        /// fraction of the operating hours spent at loadFactor
+        double hoursFraction;
+    };
+
+    struct InstalledMotor {
+        /**
+         * Constructor
+         * @param lineFrequency Motor::LineFrequency, classification of line frequency in Hz
+         * @param motorRpm double, RPM of motor
+         * @param efficiencyClass Motor::EfficiencyClass, classification of motor efficiency
+         * @param motorRatedPower double, rated power of motor in hp
+         * @param specifiedEfficiency double, efficiency of SPECIFIED efficiency class motor as %
+         * @param ratedVoltage double, rated voltage of motor in volts
+         * @param loadProfile std::vector<LoadPoint>, load factors and the fraction of operating hours at each
+         * @param operatingHours double, annual operating hours
+         * @param unitCost double, cost of electricity per kWh
+         */
+        InstalledMotor(Motor::LineFrequency lineFrequency, double motorRpm, Motor::EfficiencyClass efficiencyClass,
+                       double motorRatedPower, double specifiedEfficiency, double ratedVoltage,
+                       std::vector<LoadPoint> loadProfile, double operatingHours, double unitCost)
+                : lineFrequency(lineFrequency), motorRpm(motorRpm), efficiencyClass(efficiencyClass),
+                  motorRatedPower(motorRatedPower), specifiedEfficiency(specifiedEfficiency),
+                  ratedVoltage(ratedVoltage), loadProfile(std::move(loadProfile)), operatingHours(operatingHours),
+                  unitCost(unitCost)
+        {}
+
+        Motor::LineFrequency lineFrequency;
+        double motorRpm;
+        Motor::EfficiencyClass efficiencyClass;
+        double motorRatedPower, specifiedEfficiency, ratedVoltage;
+        std::vector<LoadPoint> loadProfile;
+        double operatingHours, unitCost;
+    };
+
+    /// A candidate replacement of an installed motor
+    struct Candidate {
+        /// index of the motor in the catalog
+        std::size_t catalogIndex;
+        /// rated power of the candidate in hp
+        double motorRatedPower;
+        /// candidate load factor at the peak shaft power of the installed motor
+        double peakLoadFactor;
+        /// estimated full load amps of the candidate at the installed rated voltage
+        double estimatedFLA;
+        /// annual energy in MWh, annual cost, and annual cost savings over the installed motor
+        double annualEnergy, annualCost, annualSavings;
+    };
+
+    struct Output {
+        /// annual energy of the installed motor in MWh and its annual cost
+        double annualEnergy, annualCost;
+        /// estimated full load amps of the installed motor
+        double estimatedFLA;
+        /// OptimalMotorSize of the peak shaft power in hp, the smallest candidate rated power
+        double optimalMotorRatedPower;
+        /// candidates by descending annual savings
+        std::vector<Candidate> candidates;
+    };
+
+    /**
+     * Constructor, calculates the curves of every catalog motor
+     * @param catalog std::vector<MotorData>, candidate replacement motors, e.g. SQLite::getMotorData()
+     * @param sizeMargin double, size margin as %, see OptimalMotorSize
+     * @param maxCandidates std::size_t, number of best candidates kept per installed motor, 0 to keep all
+     * @param threadCount unsigned, number of threads installed motors are evaluated on
+     * @throws std::runtime_error if a catalog motor has no nominal efficiency
+     */
+    MotorFleetAnalyzer(std::vector<MotorData> catalog, double sizeMargin, std::size_t maxCandidates = 0,
+                       unsigned threadCount = 1);
+
+    /**
+     * Evaluates the installed motors and ranks their candidate replacements
+     * @param fleet std::vector<InstalledMotor>, installed motors
+     * @return std::vector<Output>, one entry per installed motor, in fleet order
+     */
+    std::vector<Output> calculate(const std::vector<InstalledMotor> &fleet) const;
+
+    /**
+     * Evaluates one installed motor and ranks its candidate replacements
+     * @param motor InstalledMotor, installed motor
+     * @return Output, results of the motor
+     */
+    Output calculate(const InstalledMotor &motor) const;
+
+    const std::vector<MotorData> & getCatalog() const { return catalog; }
+
+private:
+    /**
+     * Annual energy of a motor over a load profile at the shaft power of the installed motor
+     * @param curves MotorCurveSet, curves of the motor
+     * @param motor InstalledMotor, installed motor whose shaft power and load profile are used
+     * @return double, annual energy in MWh
+     */
+    static double annualEnergy(const MotorCurveSet &curves, const InstalledMotor &motor);
+
+    std::vector<MotorData> catalog;
+    /// curves of each catalog motor at the reference voltage of 460 V
+    std::vector<MotorCurveSet> catalogCurves;
+    double sizeMargin;
+    std::size_t maxCandidates;
+    unsigned threadCount;
+};
+
+#endif //AMO_LIBRARY_MOTORFLEETANALYZER_H
@@ -0,0 +1,84 @@
+/**
+ * @file
+ * @brief Energy use of a motor over a variable load profile
+ *
+ * This contains the prototypes of the MotorLoadProfileEnergy calculator, which integrates motor input power, shaft
+ * power and losses over a load histogram or an hourly series of measurements.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_LIBRARY_MOTORLOADPROFILEENERGY_H
+#define AMO_LIBRARY_MOTORLOADPROFILEENERGY_H
+
+#include <vector>
+#include <results/InputData.h>
+#include "MotorCurveSet.h"
+
+/**
+ * Integrates the energy use of one motor over a load profile given as measured power or measured current, with the
+ * same semantics as the POWER and CURRENT load estimation methods of MotorShaftPower.
+ *
+ * Every operating point is evaluated by MotorShaftPower on one MotorCurveSet, and an hourly series is first reduced to
+ * a histogram of its distinct measurements, so each distinct measurement is evaluated once. Measurements of 0 or less
+ * are hours the motor is off.
+ */
+class MotorLoadProfileEnergy {
+public:
+    /// One bin of a load histogram
+    struct Bin {
+        /// measured power in kW (POWER) or measured current in A (CURRENT)
+        double measurement;
+        /// hours spent at the measurement
+        double hours;
+    };
+
+    struct Output {
+        /// hours in the profile, and hours the motor is running
+        double totalHours, operatingHours;
+        /// electric input energy, shaft energy and motor losses in MWh
+        double inputEnergy, shaftEnergy, lossEnergy;
+        /// operating hours weighted average and peak load factor - unitless
+        double averageLoadFactor, peakLoadFactor;
+        /// shaft energy over input energy, i.e. the energy weighted average motor efficiency - fraction
+        double averageEfficiency;
+    };
+
+    /**
+     * Constructor
+     * @param curves MotorCurveSet, curves of the motor; must outlive this object
+     * @param fieldVoltage double, field voltage in V
+     * @param loadEstimationMethod Motor::LoadEstimationMethod, whether the measurements are power or current
+     * @param loadSolver Motor::LoadSolver, how MotorShaftPower finds the motor load
+     */
+    MotorLoadProfileEnergy(const MotorCurveSet &curves, double fieldVoltage,
+                           Motor::LoadEstimationMethod loadEstimationMethod,
+                           Motor::LoadSolver loadSolver = Motor::LoadSolver::BISECTION)
+            : curves(curves), fieldVoltage(fieldVoltage), loadEstimationMethod(loadEstimationMethod),
+              loadSolver(loadSolver)
+    {}
+
+    /**
+     * Integrates over a load histogram
+     * @param histogram std::vector<Bin>, measurements and the hours spent at each
+     * @return Output, energy use over the histogram
+     */
+    Output calculate(const std::vector<Bin> &histogram) const;
+
+    /**
+     * Integrates over a series of measurements taken at a fixed interval, e.g. 8760 hourly measurements of a year
+     * @param series std::vector<double>, measured power in kW (POWER) or measured current in A (CURRENT)
+     * @param hoursPerMeasurement double, hours each measurement stands for
+     * @return Output, energy use over the series
+     */
+    Output calculate(const std::vector<double> &series, double hoursPerMeasurement = 1) const;
+
+private:
+    const MotorCurveSet &curves;
+    double fieldVoltage;
+    Motor::LoadEstimationMethod loadEstimationMethod;
+    Motor::LoadSolver loadSolver;
+};
+
+#endif //AMO_LIBRARY_MOTORLOADPROFILEENERGY_H
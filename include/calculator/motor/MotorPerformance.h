@@ -11,6 +11,7 @@
 
 #include <array>
 #include <results/InputData.h>
+#include "MotorCurveSet.h"
 #include <exception>
 #include <stdexcept>
 
@@ -59,6 +60,23 @@ public:
         fullLoadAmps(fullLoadAmps)
     {};
 
+    /**
+     * Constructor evaluating the precomputed curves of a motor
+     * @param curves MotorCurveSet, curves of the motor; must outlive this object
+     * @param loadFactor double, load factor - unitless
+     */
+    MotorPerformance(const MotorCurveSet &curves, double loadFactor) :
+        lineFrequency(curves.getLineFrequency()),
+        motorRpm(curves.getMotorRpm()),
+        efficiencyClass(curves.getEfficiencyClass()),
+        motorRatedPower(curves.getMotorRatedPower()),
+        specifiedEfficiency(curves.getSpecifiedEfficiency()),
+        loadFactor(loadFactor),
+        ratedVoltage(curves.getRatedVoltage()),
+        fullLoadAmps(curves.getFullLoadAmps()),
+        curves(&curves)
+    {};
+
     /**
      * Calculates motor performance
      */
@@ -73,6 +91,7 @@ private:
         double loadFactor;
         double ratedVoltage;
         double fullLoadAmps;
+        const MotorCurveSet *curves = nullptr;
 };
 
 
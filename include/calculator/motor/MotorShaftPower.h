@@ -19,6 +19,7 @@
 #define AMO_LIBRARY_MOTORSHAFTPOWER_H
 
 #include <results/InputData.h>
+#include "MotorCurveSet.h"
 
 /**
  * Motor Shaft Power class
@@ -62,6 +63,7 @@ public:
     * @param fieldVoltage double, Field voltage in volts
     * @param loadEstimationMethod FieldData::LoadEstimationMethod, estimated power or current on motor input in hp
     * @param fieldCurrent double, field current as defined in amps.
+    * @param loadSolver Motor::LoadSolver, stepping through or bisecting the 1% load steps
     *
     */
     MotorShaftPower(
@@ -75,7 +77,8 @@ public:
 		const double fullLoadAmps,
 		const double fieldVoltage,
 		const Motor::LoadEstimationMethod loadEstimationMethod,
-		const double fieldCurrent
+		const double fieldCurrent,
+		const Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP
 	) :
 		motorRatedPower(motorRatedPower),
 		fieldPower(motorMeasuredPower),
@@ -87,7 +90,40 @@ public:
 		efficiencyClass(efficiencyClass),
 		specifiedEfficiency(specifiedEfficiency),
 		fieldCurrent(fieldCurrent),
-		loadEstimationMethod(loadEstimationMethod)
+		loadEstimationMethod(loadEstimationMethod),
+		loadSolver(loadSolver)
+	{};
+
+	/**
+	 * Constructor evaluating the precomputed curves of a motor, for assessing many operating points of the same motor
+	 * @param curves MotorCurveSet, curves of the motor; must outlive this object
+	 * @param motorMeasuredPower double, measured electrical power in kWe
+	 * @param fieldVoltage double, field voltage in V
+	 * @param loadEstimationMethod Motor::LoadEstimationMethod, estimate load from power or current
+	 * @param fieldCurrent double, measured current in A
+	 * @param loadSolver Motor::LoadSolver, stepping through or bisecting the 1% load steps
+	 */
+	MotorShaftPower(
+		const MotorCurveSet &curves,
+		const double motorMeasuredPower,
+		const double fieldVoltage,
+		const Motor::LoadEstimationMethod loadEstimationMethod,
+		const double fieldCurrent,
+		const Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP
+	) :
+		motorRatedPower(curves.getMotorRatedPower()),
+		fieldPower(motorMeasuredPower),
+		motorRPM(curves.getMotorRpm()),
+		lineFrequency(curves.getLineFrequency()),
+		ratedVoltage(curves.getRatedVoltage()),
+		fullLoadAmps(curves.getFullLoadAmps()),
+		fieldVoltage(fieldVoltage),
+		efficiencyClass(curves.getEfficiencyClass()),
+		specifiedEfficiency(curves.getSpecifiedEfficiency()),
+		fieldCurrent(fieldCurrent),
+		loadEstimationMethod(loadEstimationMethod),
+		loadSolver(loadSolver),
+		curves(&curves)
 	{};
 
 	/**
@@ -97,6 +133,8 @@ public:
     Output calculate();
 
 private:
+    Output calculateFromCurves(const MotorCurveSet &curves) const;
+
     double motorRatedPower, fieldPower, motorRPM;
     Motor::LineFrequency lineFrequency;
     double ratedVoltage, fullLoadAmps, fieldVoltage;
@@ -104,6 +142,8 @@ private:
 
     double specifiedEfficiency, fieldCurrent;
     Motor::LoadEstimationMethod loadEstimationMethod;
+    Motor::LoadSolver loadSolver;
+    const MotorCurveSet *curves = nullptr;
 };
 
 #endif //AMO_LIBRARY_MOTORSHAFTPOWER_H
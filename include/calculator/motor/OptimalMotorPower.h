@@ -14,6 +14,7 @@
 #define AMO_LIBRARY_OPTIMALMOTORPOWER_H
 
 #include "results/Results.h"
+#include "MotorCurveSet.h"
 
 class OptimalMotorPower {
 public:
@@ -43,6 +44,7 @@ public:
      * @param fullLoadAmps double, Current at full load in A
      * @param fieldVoltage double, Field voltage in V
      * @param optimalMotorShaftPower double, Optimal shaft power as defined in hp
+     * @param loadSolver Motor::LoadSolver, stepping through or bisecting the 1% load steps
      */
     OptimalMotorPower(
         double motorRatedPower,
@@ -52,7 +54,8 @@ public:
         double specifiedEfficiency,
         double ratedVoltage,
         double fieldVoltage,
-        double optimalMotorShaftPower
+        double optimalMotorShaftPower,
+        Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP
     ) :
         optimalMotorShaftPower(optimalMotorShaftPower),
         motorRatedPower(motorRatedPower),
@@ -61,7 +64,33 @@ public:
         ratedVoltage(ratedVoltage),
         fieldVoltage(fieldVoltage),
         efficiencyClass(efficiencyClass),
-        specifiedEfficiency(specifiedEfficiency)
+        specifiedEfficiency(specifiedEfficiency),
+        loadSolver(loadSolver)
+    {};
+
+    /**
+     * Constructor evaluating the precomputed curves of a motor
+     * @param curves MotorCurveSet, curves of the motor; must outlive this object
+     * @param fieldVoltage double, Field voltage in V
+     * @param optimalMotorShaftPower double, Optimal shaft power as defined in hp
+     * @param loadSolver Motor::LoadSolver, stepping through or bisecting the 1% load steps
+     */
+    OptimalMotorPower(
+        const MotorCurveSet &curves,
+        double fieldVoltage,
+        double optimalMotorShaftPower,
+        Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP
+    ) :
+        optimalMotorShaftPower(optimalMotorShaftPower),
+        motorRatedPower(curves.getMotorRatedPower()),
+        motorRPM(curves.getMotorRpm()),
+        lineFrequency(curves.getLineFrequency()),
+        ratedVoltage(curves.getRatedVoltage()),
+        fieldVoltage(fieldVoltage),
+        efficiencyClass(curves.getEfficiencyClass()),
+        specifiedEfficiency(curves.getSpecifiedEfficiency()),
+        loadSolver(loadSolver),
+        curves(&curves)
     {};
 
     /**
@@ -86,11 +115,15 @@ public:
     }
 
 private:
+    Output calculateFromCurves(const MotorCurveSet &curves) const;
+
     double optimalMotorShaftPower, motorRatedPower, motorRPM;
     Motor::LineFrequency lineFrequency;
     double ratedVoltage, fieldVoltage;
     Motor::EfficiencyClass efficiencyClass;
     double specifiedEfficiency;
+    Motor::LoadSolver loadSolver;
+    const MotorCurveSet *curves = nullptr;
 };
 
 
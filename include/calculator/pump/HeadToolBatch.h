@@ -0,0 +1,90 @@
+/**
+ * @brief Operating pump head of many flow and pressure readings
+ *
+ * This contains the prototypes of the HeadToolBatch, the array counterpart of HeadTool and HeadToolSuctionTank.
+ *
+ * @bug No known bugs.
+ */
+
+#ifndef AMO_TOOLS_SUITE_HEADTOOLBATCH_H
+#define AMO_TOOLS_SUITE_HEADTOOLBATCH_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Calculates the operating pump head of one pump installation at many readings of flow rate, suction pressure and
+ * discharge pressure, e.g. logged minute by minute.
+ *
+ * The pipe diameters, line loss coefficients and elevations are fixed, so the velocity heads are the flow rate squared
+ * times a coefficient calculated once. Results are the same as those of HeadTool (suction gauge) and
+ * HeadToolSuctionTank (suction tank) up to rounding.
+ */
+class HeadToolBatch {
+public:
+    /// Where the suction pressure and elevation are taken
+    enum class Suction {
+        /// suction gauge, as HeadTool
+        GAUGE,
+        /// suction tank gas over pressure and fluid surface elevation, as HeadToolSuctionTank
+        TANK
+    };
+
+    /// One entry per reading in each column
+    struct Output {
+        std::vector<double> pressureHead, velocityHeadDifferential, suctionHead, dischargeHead, pumpHead;
+        /// elevation head, the same for all readings
+        double elevationHead;
+    };
+
+    /**
+     * Constructor
+     * @param suction Suction, suction gauge or suction tank
+     * @param specificGravity double, specific gravity - unitless
+     * @param suctionPipeDiameter double, diameter of suction pipe in inches
+     * @param suctionElevation double, suction gauge elevation or suction tank fluid surface elevation in feet
+     * @param suctionLineLossCoefficients double, line loss coefficients of suction - unitless
+     * @param dischargePipeDiameter double, diameter of discharge pipe in inches
+     * @param dischargeGaugeElevation double, gauge elevation of discharge in feet
+     * @param dischargeLineLossCoefficients double, line loss coefficients of discharge - unitless
+     */
+    HeadToolBatch(Suction suction, double specificGravity, double suctionPipeDiameter, double suctionElevation,
+                  double suctionLineLossCoefficients, double dischargePipeDiameter, double dischargeGaugeElevation,
+                  double dischargeLineLossCoefficients);
+
+    /**
+     * Calculates the operating pump head of each reading
+     * @param flowRates const double *, flow rates in gpm
+     * @param suctionPressures const double *, suction gauge pressures or suction tank gas over pressures in psig
+     * @param dischargePressures const double *, discharge gauge pressures in psig
+     * @param pumpHeads double *, receives the operating pump heads in ft
+     * @param count std::size_t, number of readings
+     */
+    void calculate(const double *flowRates, const double *suctionPressures, const double *dischargePressures,
+                   double *pumpHeads, std::size_t count) const;
+
+    /**
+     * Calculates all head components of each reading
+     * @param flowRates std::vector<double>, flow rates in gpm
+     * @param suctionPressures std::vector<double>, suction gauge pressures or suction tank gas over pressures in psig
+     * @param dischargePressures std::vector<double>, discharge gauge pressures in psig
+     * @return Output, head components in ft
+     * @throws std::runtime_error if the readings are not all the same size
+     */
+    Output calculate(const std::vector<double> &flowRates, const std::vector<double> &suctionPressures,
+                     const std::vector<double> &dischargePressures) const;
+
+private:
+    double elevationHead;
+    /// pressure head per psi of differential pressure
+    double pressureHeadCoefficient;
+    /// suction and discharge velocity head per gpm squared
+    double suctionVelocityHeadCoefficient, dischargeVelocityHeadCoefficient;
+    double suctionLineLossCoefficients, dischargeLineLossCoefficients;
+    /// the suction velocity head is subtracted from the velocity head differential with a suction gauge only
+    double suctionVelocityHeadSign;
+    /// velocity head differential, suction head and discharge head per gpm squared
+    double flowHeadCoefficient;
+};
+
+#endif //AMO_TOOLS_SUITE_HEADTOOLBATCH_H
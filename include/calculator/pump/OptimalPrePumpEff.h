@@ -11,6 +11,7 @@
 #ifndef AMO_LIBRARY_OPTIMALPREPUMPEFF_H
 #define AMO_LIBRARY_OPTIMALPREPUMPEFF_H
 
+#include <cstddef>
 #include <results/InputData.h>
 
 class OptimalPrePumpEff {
@@ -34,6 +35,26 @@ public:
      */
     double calculate();
 
+    /**
+     * Calculates the optimal prepump efficiency of many pumps of one style. The style selects a row of a coefficient
+     * table once, and the flow rate range is found without branching.
+     * @param style Pump::Style, style of the pumps
+     * @param flowRates const double *, measured or required flow rates in gpm
+     * @param efficiencies double *, receives the optimal prepump efficiencies as %, one per flow rate
+     * @param count std::size_t, number of flow rates
+     */
+    static void calculate(Pump::Style style, const double *flowRates, double *efficiencies, std::size_t count);
+
+    /**
+     * Calculates the optimal prepump efficiency of many pumps of any style
+     * @param styles const Pump::Style *, style of each pump
+     * @param flowRates const double *, measured or required flow rate of each pump in gpm
+     * @param efficiencies double *, receives the optimal prepump efficiency of each pump as %
+     * @param count std::size_t, number of pumps
+     */
+    static void calculate(const Pump::Style *styles, const double *flowRates, double *efficiencies,
+                          std::size_t count);
+
 private:
     const Pump::Style style;
     const double flowRate;
@@ -12,6 +12,7 @@
 #ifndef AMO_LIBRARY_OPTIMALPUMPEFFICIENCY_H
 #define AMO_LIBRARY_OPTIMALPUMPEFFICIENCY_H
 
+#include <cstddef>
 #include <results/InputData.h>
 
 class OptimalPumpEfficiency {
@@ -58,6 +59,24 @@ public:
      */
     double calculate();
 
+    /**
+     * Calculates the optimal pump efficiency of one pump style and fluid at many operating points.
+     *
+     * The fluid term of the viscosity correction is calculated once and the pump speed term once per run of equal
+     * speeds. The fractional powers of flow rate, head and speed are taken with sqrt chains, leaving one log and two
+     * exp per point for the viscosity correction factor. Results equal those of calculate() up to rounding.
+     * @param style Pump::Style, style of pump being used
+     * @param kinematicViscosity double, kinematic viscosity of the fluid being pumped in centistokes
+     * @param stageCount double, the number of pump stages
+     * @param flowRates const double *, measured or required flow rates in gpm
+     * @param heads const double *, pump heads in ft, one per flow rate
+     * @param rpms const double *, pump speeds in rpm, one per flow rate
+     * @param efficiencies double *, receives the optimal pump efficiencies, one per flow rate
+     * @param count std::size_t, number of operating points
+     */
+    static void calculate(Pump::Style style, double kinematicViscosity, double stageCount, const double *flowRates,
+                          const double *heads, const double *rpms, double *efficiencies, std::size_t count);
+
     /**
      * Gets the style of the pump
      * @return Pump::Style, style of pump
@@ -180,7 +199,6 @@ private:
     double head;
     double actualEfficiency;
     double optimalEfficiency;
-    double prePumpEfficiency = 0.0;
 };
 
 
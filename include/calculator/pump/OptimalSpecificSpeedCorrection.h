@@ -11,6 +11,7 @@
 #ifndef AMO_LIBRARY_OPTIMALSPECIFICSPEEDCORRECTION_H
 #define AMO_LIBRARY_OPTIMALSPECIFICSPEEDCORRECTION_H
 
+#include <cstddef>
 #include <results/InputData.h>
 
 class OptimalSpecificSpeedCorrection {
@@ -34,6 +35,26 @@ public:
      */
     double calculate();
 
+    /**
+     * Calculates the optimal specific speed correction of many pumps of one style. The correction polynomials are
+     * evaluated in Horner form from a coefficient table, with no per pump dispatch on the style.
+     * @param style Pump::Style, style of the pumps
+     * @param specificSpeeds const double *, specific speeds in rpm*sqrt(gpm)/((ft/s)^(3/2))
+     * @param corrections double *, receives the optimal specific speed corrections, one per specific speed
+     * @param count std::size_t, number of specific speeds
+     */
+    static void calculate(Pump::Style style, const double *specificSpeeds, double *corrections, std::size_t count);
+
+    /**
+     * Calculates the optimal specific speed correction of many pumps of any style
+     * @param styles const Pump::Style *, style of each pump
+     * @param specificSpeeds const double *, specific speed of each pump in rpm*sqrt(gpm)/((ft/s)^(3/2))
+     * @param corrections double *, receives the optimal specific speed correction of each pump
+     * @param count std::size_t, number of pumps
+     */
+    static void calculate(const Pump::Style *styles, const double *specificSpeeds, double *corrections,
+                          std::size_t count);
+
 private:
     const double specificSpeed;
     const Pump::Style style;
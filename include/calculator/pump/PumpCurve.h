@@ -0,0 +1,88 @@
+/**
+ * @brief Pump performance curve
+ *
+ * This contains the prototypes of the PumpCurve, the head and efficiency of a pump over flow rate at its rated speed,
+ * given as polynomials or as a table of points from the manufacturer's curve.
+ *
+ * @bug No known bugs.
+ */
+
+#ifndef AMO_TOOLS_SUITE_PUMPCURVE_H
+#define AMO_TOOLS_SUITE_PUMPCURVE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Head and efficiency of a pump at its rated speed. Polynomial curves are evaluated with Horner's method; tabulated
+ * curves are interpolated linearly between points and extrapolated linearly from the end segments.
+ */
+class PumpCurve {
+public:
+    /// A point of a tabulated pump curve
+    struct Point {
+        /// flow rate in gpm
+        double flowRate;
+        /// head in ft
+        double head;
+        /// pump efficiency as fraction
+        double efficiency;
+    };
+
+    /**
+     * Constructor for a polynomial pump curve
+     * @param ratedSpeed double, pump speed the curve is given at in rpm
+     * @param headCoefficients std::vector<double>, head in ft over flow rate in gpm, lowest order first
+     * @param efficiencyCoefficients std::vector<double>, efficiency as fraction over flow rate in gpm, lowest order
+     *        first
+     * @param maxFlowRate double, end of the curve in gpm
+     * @throws std::runtime_error if a coefficient vector is empty, or the speed or end of the curve is not positive
+     */
+    PumpCurve(double ratedSpeed, std::vector<double> headCoefficients, std::vector<double> efficiencyCoefficients,
+              double maxFlowRate);
+
+    /**
+     * Constructor for a tabulated pump curve
+     * @param ratedSpeed double, pump speed the curve is given at in rpm
+     * @param points std::vector<Point>, points of the curve by increasing flow rate, the first at 0 gpm (shutoff)
+     * @throws std::runtime_error if there are fewer than 2 points, the first is not at shutoff, the flow rates are not
+     *         increasing or the speed is not positive
+     */
+    PumpCurve(double ratedSpeed, std::vector<Point> points);
+
+    /**
+     * @param flowRate double, flow rate at rated speed in gpm
+     * @return double, head at rated speed in ft
+     */
+    double head(double flowRate) const;
+
+    /**
+     * @param flowRate double, flow rate at rated speed in gpm
+     * @return double, derivative of head with respect to flow rate in ft/gpm
+     */
+    double headSlope(double flowRate) const;
+
+    /**
+     * @param flowRate double, flow rate at rated speed in gpm
+     * @return double, pump efficiency as fraction
+     */
+    double efficiency(double flowRate) const;
+
+    double getRatedSpeed() const { return ratedSpeed; }
+
+    /**
+     * @return double, end of the curve at rated speed in gpm
+     */
+    double getMaxFlowRate() const { return maxFlowRate; }
+
+private:
+    /// index of the tabulated segment containing flowRate, the end segments extended
+    std::size_t segment(double flowRate) const;
+
+    double ratedSpeed;
+    std::vector<double> headCoefficients, efficiencyCoefficients;
+    std::vector<Point> points;
+    double maxFlowRate;
+};
+
+#endif //AMO_TOOLS_SUITE_PUMPCURVE_H
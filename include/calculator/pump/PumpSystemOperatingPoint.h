@@ -0,0 +1,103 @@
+/**
+ * @brief Operating point of a pump on a system curve at variable speed
+ *
+ * This contains the prototypes of the PumpSystemOperatingPoint calculator, which intersects a pump curve scaled by the
+ * affinity laws with a system curve and evaluates the power drawn at the operating point.
+ *
+ * @bug No known bugs.
+ */
+
+#ifndef AMO_TOOLS_SUITE_PUMPSYSTEMOPERATINGPOINT_H
+#define AMO_TOOLS_SUITE_PUMPSYSTEMOPERATINGPOINT_H
+
+#include <utility>
+#include <vector>
+#include <results/InputData.h>
+#include <calculator/motor/MotorCurveSet.h>
+#include "PumpCurve.h"
+#include "SystemCurve.h"
+
+/**
+ * Finds where a pump running at a given speed operates on a system curve, e.g. for a VFD retrofit evaluation.
+ *
+ * At speed ratio r = speed / rated speed the affinity laws give the pump head r^2 * H(Q / r) and the pump efficiency
+ * eta(Q / r). The flow rate at which this head meets the system head is found by Newton's method, safeguarded by
+ * bisection on a bracket of the intersection, so piecewise linear tabulated curves converge as well as polynomials.
+ * Power at the operating point is then calculated as in PSATResult::calculateModified: OptimalPumpShaftPower,
+ * OptimalMotorShaftPower for the drive, and OptimalMotorPower on the motor curves.
+ */
+class PumpSystemOperatingPoint {
+public:
+    struct Output {
+        /// pump speed in rpm
+        double speed;
+        /// flow rate in gpm and head in ft at the operating point; 0 gpm and the shutoff head if the pump does not
+        /// overcome the static head at this speed
+        double flowRate, head;
+        /// pump efficiency and drive efficiency as fraction
+        double pumpEfficiency, driveEfficiency;
+        /// pump and motor shaft power in hp, 0 with no flow
+        double pumpShaftPower, motorShaftPower;
+        /// motor efficiency as fraction, motor load factor - unitless, motor power in kW, 0 with no flow
+        double motorEfficiency, loadFactor, motorPower;
+    };
+
+    /**
+     * Constructor
+     * @param pumpCurve PumpCurve, pump head and efficiency at rated speed
+     * @param systemCurve SystemCurve, system head
+     * @param specificGravity double, specific gravity - unitless
+     * @param drive Motor::Drive, type of drive
+     * @param specifiedDriveEfficiency double, drive efficiency as fraction, used with the SPECIFIED drive
+     * @param motorCurves MotorCurveSet, curves of the motor; must outlive this object
+     * @param fieldVoltage double, field voltage in V
+     * @param loadSolver Motor::LoadSolver, how OptimalMotorPower finds the motor load
+     */
+    PumpSystemOperatingPoint(PumpCurve pumpCurve, SystemCurve systemCurve, double specificGravity, Motor::Drive drive,
+                             double specifiedDriveEfficiency, const MotorCurveSet &motorCurves, double fieldVoltage,
+                             Motor::LoadSolver loadSolver = Motor::LoadSolver::BISECTION)
+            : pumpCurve(std::move(pumpCurve)), systemCurve(systemCurve), specificGravity(specificGravity), drive(drive),
+              specifiedDriveEfficiency(specifiedDriveEfficiency), motorCurves(motorCurves), fieldVoltage(fieldVoltage),
+              loadSolver(loadSolver)
+    {}
+
+    /**
+     * Calculates the operating point at one speed
+     * @param speed double, pump speed in rpm
+     * @return Output, operating point and power
+     * @throws std::runtime_error if the speed is not positive, the system curve stays below the pump curve up to the
+     *         end of the curve, the flow rate iteration does not converge, or the pump efficiency at the operating
+     *         point is not positive
+     */
+    Output calculate(double speed) const;
+
+    /**
+     * Calculates the operating point at each speed, e.g. the speeds of a duty cycle; weight the results by the hours
+     * at each speed for energy use
+     * @param speeds std::vector<double>, pump speeds in rpm
+     * @return std::vector<Output>, operating point and power at each speed
+     * @throws std::runtime_error as calculate(double)
+     */
+    std::vector<Output> calculate(const std::vector<double> &speeds) const;
+
+    /**
+     * Flow rate at which the pump at a speed ratio meets the system curve
+     * @param speedRatio double, speed over rated speed - unitless
+     * @return double, flow rate in gpm, 0 if the pump does not overcome the static head
+     * @throws std::runtime_error if the system curve stays below the pump curve up to the end of the curve, or the
+     *         iteration does not converge
+     */
+    double intersect(double speedRatio) const;
+
+private:
+    PumpCurve pumpCurve;
+    SystemCurve systemCurve;
+    double specificGravity;
+    Motor::Drive drive;
+    double specifiedDriveEfficiency;
+    const MotorCurveSet &motorCurves;
+    double fieldVoltage;
+    Motor::LoadSolver loadSolver;
+};
+
+#endif //AMO_TOOLS_SUITE_PUMPSYSTEMOPERATINGPOINT_H
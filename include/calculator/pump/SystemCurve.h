@@ -0,0 +1,96 @@
+/**
+ * @brief System curve of a pumping system
+ *
+ * This contains the prototypes of the SystemCurve, the head a system requires as static head plus k times the
+ * flow rate squared, and its least squares fit from measured operating points.
+ *
+ * @bug No known bugs.
+ */
+
+#ifndef AMO_TOOLS_SUITE_SYSTEMCURVE_H
+#define AMO_TOOLS_SUITE_SYSTEMCURVE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * System curve head = staticHead + lossCoefficient * flowRate^2, in ft and gpm.
+ */
+class SystemCurve {
+public:
+    /// An operating point on a pump or system curve
+    struct Point {
+        /// flow rate in gpm
+        double flowRate;
+        /// head in ft
+        double head;
+    };
+
+    /**
+     * Constructor
+     * @param staticHead double, head at zero flow in ft
+     * @param lossCoefficient double, friction loss coefficient in ft/gpm^2
+     */
+    SystemCurve(double staticHead, double lossCoefficient)
+            : staticHead(staticHead), lossCoefficient(lossCoefficient)
+    {}
+
+    /**
+     * Least squares fit of the static head and loss coefficient to measured operating points, e.g. the flow rates and
+     * pump heads calculated by HeadToolBatch
+     * @param points std::vector<Point>, measured operating points
+     * @return SystemCurve, fitted system curve
+     * @throws std::runtime_error if fewer than two distinct flow rates are given
+     */
+    static SystemCurve fit(const std::vector<Point> &points);
+
+    /**
+     * Least squares fit of the loss coefficient to measured operating points of a system with a known static head
+     * @param staticHead double, head at zero flow in ft
+     * @param points std::vector<Point>, measured operating points
+     * @return SystemCurve, fitted system curve
+     * @throws std::runtime_error if no point has a flow rate other than zero
+     */
+    static SystemCurve fit(double staticHead, const std::vector<Point> &points);
+
+    /**
+     * @param flowRate double, flow rate in gpm
+     * @return double, system head in ft
+     */
+    double head(const double flowRate) const {
+        return staticHead + lossCoefficient * flowRate * flowRate;
+    }
+
+    /**
+     * @param flowRates const double *, flow rates in gpm
+     * @param heads double *, receives the system heads in ft
+     * @param count std::size_t, number of flow rates
+     */
+    void head(const double *flowRates, double *heads, std::size_t count) const;
+
+    /**
+     * Flow rate the system passes at a head, 0 at or below the static head
+     * @param head double, head in ft
+     * @return double, flow rate in gpm
+     */
+    double flowRate(double head) const;
+
+    /**
+     * Dense system curve at evenly spaced flow rates from 0 to maxFlowRate, for plotting against pump curves
+     * @param maxFlowRate double, highest flow rate in gpm
+     * @param pointCount std::size_t, number of points, at least 2
+     * @return std::vector<Point>, points of the system curve
+     * @throws std::runtime_error if pointCount is less than 2
+     */
+    std::vector<Point> curve(double maxFlowRate, std::size_t pointCount) const;
+
+    double getStaticHead() const { return staticHead; }
+
+    double getLossCoefficient() const { return lossCoefficient; }
+
+private:
+    double staticHead;
+    double lossCoefficient;
+};
+
+#endif //AMO_TOOLS_SUITE_SYSTEMCURVE_H
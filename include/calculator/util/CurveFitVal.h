@@ -18,6 +18,15 @@
 
 class CurveFitVal {
 public:
+    /**
+     * Node sets (x coordinates) of the motor part load curves that have a closed-form fit, see fixedNodeFit
+     */
+    enum class FixedNodes {
+        ZERO_TO_HALF_LOAD, ///< {0, .25, .5}, 2nd order
+        QUARTER_TO_125_LOAD, ///< {.25, .5, .75, 1, 1.25}, 4th order
+        THREE_QUARTER_TO_125_LOAD ///< {.75, 1, 1.25}, 2nd order
+    };
+
     /**
      * Constructor
      * @param xcoord vector of x coordinates as doubles
@@ -50,6 +59,42 @@ public:
     double calculate() const;
     double calculate(double) const;
 
+    /**
+     * Calculates the curve fit value at the fixed nodes without constructing a CurveFitVal.
+     * There are as many nodes as coefficients, so the least squares fit is the interpolating polynomial; its
+     * coefficients are the product of the precomputed inverse Vandermonde matrix of the node set and ycoord,
+     * evaluated with Horner's method. No memory is allocated.
+     * @param nodes FixedNodes, node set to fit at
+     * @param ycoord pointer to the y coordinates at the nodes, 3 or 5 values depending on the node set
+     * @param loadFactor double, load factor (x coordinate) to evaluate the curve at - unitless
+     * @return double, curve fit value
+     */
+    static double fixedNodeFit(FixedNodes nodes, const double *ycoord, double loadFactor);
+
+    /**
+     * Number of nodes, and thereby fit coefficients, of a fixed node set
+     * @param nodes FixedNodes, node set
+     * @return std::size_t, 3 or 5
+     */
+    static std::size_t fixedNodeCount(FixedNodes nodes);
+
+    /**
+     * Calculates the fit coefficients of fixedNodeFit, for callers that evaluate the same curve at many load factors
+     * @param nodes FixedNodes, node set to fit at
+     * @param ycoord pointer to the y coordinates at the nodes, fixedNodeCount(nodes) values
+     * @param coeff pointer to fixedNodeCount(nodes) doubles receiving the coefficients, lowest order first
+     */
+    static void fixedNodeCoefficients(FixedNodes nodes, const double *ycoord, double *coeff);
+
+    /**
+     * Evaluates coefficients from fixedNodeCoefficients; gives the same result as fixedNodeFit on the same y coordinates
+     * @param nodes FixedNodes, node set the coefficients were fit at
+     * @param coeff pointer to fixedNodeCount(nodes) coefficients, lowest order first
+     * @param loadFactor double, load factor (x coordinate) to evaluate the curve at - unitless
+     * @return double, curve fit value
+     */
+    static double fixedNodePolynomial(FixedNodes nodes, const double *coeff, double loadFactor);
+
 private:
     /**
      * Degree of polynomial curve
@@ -0,0 +1,51 @@
+/**
+ * @brief Safeguarded Newton root finder
+ *
+ * This contains the prototypes of the SafeguardedNewton root finder, shared by the operating point calculations that
+ * intersect a curve scaled by the affinity laws with a system curve.
+ *
+ * @bug No known bugs.
+ */
+
+#ifndef AMO_TOOLS_SUITE_SAFEGUARDEDNEWTON_H
+#define AMO_TOOLS_SUITE_SAFEGUARDEDNEWTON_H
+
+#include <functional>
+#include <utility>
+
+/**
+ * Finds a root of a function on a bracket by Newton's method, safeguarded by bisection: it starts from the secant of
+ * the bracket, then takes Newton steps, and bisects when a step leaves the bracket or does not at least halve the
+ * previous step. Piecewise linear tabulated curves therefore converge as well as polynomials.
+ */
+class SafeguardedNewton {
+public:
+    /**
+     * Constructor
+     * @param function std::function<double(double)>, function to find the root of
+     * @param slope std::function<double(double)>, derivative of the function
+     * @param tolerance double, width of the bracket or Newton step at which the root is accepted
+     */
+    SafeguardedNewton(std::function<double(double)> function, std::function<double(double)> slope,
+                      const double tolerance)
+            : function(std::move(function)), slope(std::move(slope)), tolerance(tolerance)
+    {}
+
+    /**
+     * Finds the root in a bracket
+     * @param low double, low end of the bracket
+     * @param high double, high end of the bracket
+     * @param fLow double, function at the low end
+     * @param fHigh double, function at the high end, of opposite sign to fLow or 0
+     * @return double, root within the tolerance
+     * @throws std::runtime_error if the iteration does not converge
+     */
+    double calculate(double low, double high, double fLow, double fHigh) const;
+
+private:
+    std::function<double(double)> function;
+    std::function<double(double)> slope;
+    double tolerance;
+};
+
+#endif //AMO_TOOLS_SUITE_SAFEGUARDEDNEWTON_H
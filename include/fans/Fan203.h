@@ -19,6 +19,7 @@
 #include <functional>
 #include "Planar.h"
 #include "FanShaftPower.h"
+#include "Psychrometrics.h"
 
 #include <fstream>
 #include <iostream>
@@ -95,7 +96,7 @@ public:
 				   InputType const inputType, double const specificGravity)
 		: tdo(dryBulbTemp), pso(staticPressure), pbo(barometricPressure), g(specificGravity), gasType(gasType)
 	{
-		saturationPressure = calculateSaturationPressure(tdo);
+		saturationPressure = Psychrometrics::saturationPressure(tdo);
 		relativeHumidity = 0;
 		if (inputType == InputType::RelativeHumidity)
 		{
@@ -103,7 +104,7 @@ public:
 		}
 		else if (inputType == InputType::DewPoint)
 		{
-			relativeHumidity = calculateSaturationPressure(relativeHumidityOrDewPoint) / saturationPressure;
+			relativeHumidity = Psychrometrics::saturationPressure(relativeHumidityOrDewPoint) / saturationPressure;
 		}
 		else if (inputType == InputType::WetBulbTemp)
 		{
@@ -137,8 +138,8 @@ public:
 	{
 		if (inputType != InputType::WetBulbTemp)
 			throw std::runtime_error("The wrong constructor for BaseGasDensity was called - check inputType field");
-		saturationPressure = calculateSaturationPressure(tdo);
-		relativeHumidity = calculateRelativeHumidityFromWetBulb(tdo, wetBulbTemp, cpGas);
+		saturationPressure = Psychrometrics::saturationPressure(tdo);
+		relativeHumidity = Psychrometrics::relativeHumidityFromWetBulb(tdo, wetBulbTemp, pbo + (pso / 13.608703), cpGas);
 
 		calculateFanAttributes(inputType);
 
@@ -208,145 +209,6 @@ public:
 
 private:
 	/**
- * @brief Calculates Wet Bulb Temperature
- * 
- * @param dryBulbTemp double, temperature of inputted air in °F
- * @param relativeHumidity double, Relative Humidity, %
- * @param barometricPressure, double, const,  pressure in Hg
- * @return wetBulbTemp double, Wet Bulb Temperature, °F
- */
-	double calculateWetBulbTemperature(double dryBulbTemp, double relativeHumidity, double absolutePressure) const
-	{
-		// Newton-Raphson iteration (solve to within 0.001% accuracy)
-
-		double humidityRatioNormal = calculateRatioRH(dryBulbTemp, relativeHumidity, absolutePressure, 1);
-		double wetBulbTemp = dryBulbTemp; // set initial guess
-		double humidityRatioNew = calculateHumidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp, 0.24);
-		if (humidityRatioNormal > 0)
-		{
-			while (fabs((humidityRatioNew - humidityRatioNormal) / humidityRatioNormal) > 0.00001)
-			{
-				double humidityRatioNew2 = calculateHumidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp - 0.001, 0.24);
-				double dw_dtwb = (humidityRatioNew - humidityRatioNew2) / 0.001;
-				wetBulbTemp = wetBulbTemp - (humidityRatioNew - humidityRatioNormal) / dw_dtwb;
-				humidityRatioNew = calculateHumidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp, 0.24);
-			}
-		}
-		else
-		{
-			while (fabs(humidityRatioNew) > 0.00001)
-			{
-				double humidityRatioNew2 = calculateHumidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp - 0.001, 0.24);
-				double dw_dtwb = (humidityRatioNew - humidityRatioNew2) / 0.001;
-				wetBulbTemp = wetBulbTemp - (humidityRatioNew - humidityRatioNormal) / dw_dtwb;
-				humidityRatioNew = calculateHumidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp, 0.24);
-			}
-		}
-		return wetBulbTemp;
-	}
-	/**
- * @brief Calculates Saturation Pressure
- * 
- * @param dryBulbTemp double, temperature of inputted air in °F
- * @return saturationPressure double, Saturation Pressure, in Hg
- */
-	double calculateSaturationPressure(double dryBulbTemp) const
-	{
-		double const C1 = -5674.5359;
-		double const C2 = 6.3925247;
-		double const C3 = -0.009677843;
-		double const C4 = 0.00000062215701;
-		double const C5 = 2.0747825 * std::pow(10, -9);
-		double const C6 = -9.484024 * std::pow(10, -13);
-		double const C7 = 4.1635019;
-		double const C8 = -5800.2206;
-		double const C9 = 1.3914993;
-		double const C10 = -0.048640239;
-		double const C11 = 0.000041764768;
-		double const C12 = -0.000000014452093;
-		double const C13 = 6.5459673;
-
-		double const tKelvin = (dryBulbTemp + 459.67) * 0.555556;
-
-		if (tKelvin < 273.15)
-		{
-			double const p = std::exp(C1 / tKelvin + C2 + tKelvin * C3 + tKelvin * tKelvin * (C4 + tKelvin * (C5 + C6 * tKelvin)) + C7 * std::log(tKelvin));
-			return p * (29.9216 / 101325);
-		}
-		double const p = std::exp(C8 / tKelvin + C9 + tKelvin * (C10 + tKelvin * (C11 + tKelvin * C12)) + C13 * std::log(tKelvin));
-
-		return p * (29.9216 / 101325);
-	}
-	/**
- * @brief Calculates Relative Humidity Ratio
- * 
- * @param dryBulbTemp double, temperature of inputted air in °F 
- * @param relativeHumidity double, relative humidity as %
- * @param barometricPressure double, pressure in Hg 
- * @param specificGravity double, specific gravity, unitless
- * @return humidityRatio double, Humidity Ratio, unitless
- */
-	double calculateRatioRH(const double dryBulbTemp, const double relativeHumidity, const double barometricPressure,
-							const double specificGravity) const
-	{
-		auto const pw = (calculateSaturationPressure(dryBulbTemp) * relativeHumidity);
-		return (18.02 / (specificGravity * 28.98)) * pw / (barometricPressure - pw);
-	}
-	/**
- * @brief Calculates Relative Humidity from Wet Bulb Temperature
- * 
- * @param dryBulbTemp double, temperature of inputted air in °F
- * @param wetBulbTemp double, wet bulb temperature in °F
- * @param cpGas double, BTU/lb-degF
- */
-	double calculateRelativeHumidityFromWetBulb(const double dryBulbTemp, const double wetBulbTemp,
-												const double cpGas) const
-	{
-		double const nMol = 0.62198;
-		double const local_pIn = pbo + (pso / 13.608703);
-		//double const pAtm = 29.9213 / pbo, nMol = 18.02 / (g * 28.98);
-		double const psatDb = calculateSaturationPressure(dryBulbTemp);
-		//	double const wSat = nMol * psatDb / (pAtm - psatDb);
-		double const psatWb = calculateSaturationPressure(wetBulbTemp);
-		double const wStar = nMol * psatWb / (local_pIn - psatWb);
-		double const w = ((1093 - (1 - 0.444) * wetBulbTemp) * wStar - cpGas * (dryBulbTemp - wetBulbTemp)) / (1093 + (0.444 * dryBulbTemp) - wetBulbTemp);
-
-		double const pV = local_pIn * w / (nMol + w);
-
-		/*
-		std::ofstream fout;
-    	fout.open("debug.txt", std::ios::app);
-		fout << "calculateRelativeHumidityFromWetBulb" << std::endl;
-		fout << "psatDb: " << psatDb << std::endl;
-		fout << "psatWb: " << psatWb << std::endl;
-		fout << "wStar:  " << wStar << std::endl;
-		fout << "w:      " << w << std::endl;
-		fout << "------------------------------" << std::endl << std::endl;
-		fout.close();
-		*/
-
-		return pV / psatDb;
-	}
-	/**
- * @brief Calculates Relative Humidity Ratio from Wet Bulb Temperature
- * 
- * @param dryBulbTemp double, temperature of inputted air in °F
- * @param wetBulbTemp double, wet bulb temperature in °F
- * @param cpGas double, BTU/lb-degF
- * @return humidityRatio double, Humidity Ratio, unitless
- */
-	double calculateHumidityRatioFromWetBulb(const double dryBulbTemp, const double wetBulbTemp, const double cpGas) const
-	{
-		double const nMol = 0.62198;
-		double const local_pIn = pbo + (pso / 13.608703);
-
-		double const psatWb = calculateSaturationPressure(wetBulbTemp);
-		double const wStar = nMol * psatWb / (local_pIn - psatWb);
-		double const w = ((1093 - (1 - 0.444) * wetBulbTemp) * wStar - cpGas * (dryBulbTemp - wetBulbTemp)) / (1093 + (0.444 * dryBulbTemp) - wetBulbTemp);
-
-		return w;
-	}
-	/**
  * @brief Calculates numerous fan attributes. Note: This function assumes that the member variables pbo, pso, saturationPressure, and relativeHumidity already 
  		  have valid values.
  * 
@@ -367,16 +229,7 @@ private:
 
 		if (inputType != InputType::DewPoint)
 		{
-			double const alpha = std::log(absolutePressure * 0.4911541 * humidityRatio / (nMol + humidityRatio));
-
-			if (tdo < 32)
-			{
-				dewPoint = 90.12 + 26.412 * alpha + 0.8927 * alpha * alpha;
-			}
-			else
-			{
-				dewPoint = 100.45 + 33.193 * alpha + 2.319 * alpha * alpha + 0.17074 * alpha * alpha * alpha + 1.2063 * (std::pow((absolutePressure * 0.4911541 * humidityRatio / (0.62196 + humidityRatio)), 0.1984));
-			}
+			dewPoint = Psychrometrics::dewPoint(tdo, humidityRatio, absolutePressure);
 		}
 		else
 		{
@@ -385,7 +238,7 @@ private:
 
 		if (inputType != InputType::WetBulbTemp) // If not given as an input, calculate wet bulb temperature
 		{
-			wetBulbTemp = calculateWetBulbTemperature(tdo, relativeHumidity, absolutePressure);
+			wetBulbTemp = Psychrometrics::wetBulbTemperature(tdo, relativeHumidity, absolutePressure);
 		}
 	}
 
@@ -470,12 +323,16 @@ public:
 				  flowTraverse(getData(planeData.flowTraverse)),
 				  inletMstPlane(getData(planeData.inletMstPlane)),
 				  outletMstPlane(getData(planeData.outletMstPlane)),
-				  addlTravPlanes(getDataTrav(planeData.addlTravPlanes))
+				  addlTravPlanes(getDataTrav(planeData.addlTravPlanes)),
+				  fanInletFlangeIterations(planeData.fanInletFlangeIterations),
+				  fanOrEvaseOutletFlangeIterations(planeData.fanOrEvaseOutletFlangeIterations)
 			{
 			}
 			DataFlange fanInletFlange, fanOrEvaseOutletFlange;
 			Data flowTraverse, inletMstPlane, outletMstPlane;
 			std::vector<Data> addlTravPlanes;
+			// density evaluations of the fan inlet and outlet flange iterations
+			int fanInletFlangeIterations, fanOrEvaseOutletFlangeIterations;
 		};
 		static Output calculate(PlaneData &planeData, BaseGasDensity const &baseGasDensity)
 		{
@@ -507,36 +364,64 @@ public:
 			  TraversePlane flowTraverse, std::vector<TraversePlane> addlTravPlanes,
 			  MstPlane inletMstPlane, MstPlane outletMstPlane,
 			  const double totalPressureLossBtwnPlanes1and4, const double totalPressureLossBtwnPlanes2and5,
-			  bool const plane5upstreamOfPlane2)
+			  bool const plane5upstreamOfPlane2, const double densityTolerance = 0.0001)
 		: fanInletFlange(std::move(fanInletFlange)), fanOrEvaseOutletFlange(std::move(fanOrEvaseOutletFlange)), flowTraverse(std::move(flowTraverse)),
 		  addlTravPlanes(std::move(addlTravPlanes)), inletMstPlane(std::move(inletMstPlane)), outletMstPlane(std::move(outletMstPlane)),
 		  plane5upstreamOfPlane2(plane5upstreamOfPlane2),
 		  totalPressureLossBtwnPlanes1and4(totalPressureLossBtwnPlanes1and4),
-		  totalPressureLossBtwnPlanes2and5(totalPressureLossBtwnPlanes2and5)
+		  totalPressureLossBtwnPlanes2and5(totalPressureLossBtwnPlanes2and5),
+		  densityTolerance(densityTolerance)
 	{
 	}
 
 private:
-	void establishFanInletOrOutletDensity(Planar &plane,
-										  std::function<double(Planar const &, const double)> const &calcDensity,
-										  double const mTotal, double const assumedDensity)
+	/**
+	 * Iterates the density of a flange plane until the density at the plane's static pressure agrees with it, to
+	 * within densityTolerance. Every other step is an Aitken extrapolation of the two before it (Steffensen's method).
+	 * @return int, number of times the density was evaluated at a static pressure
+	 */
+	int establishFanInletOrOutletDensity(Planar &plane,
+										 std::function<double(Planar const &, const double)> const &calcDensity,
+										 double const mTotal, double const assumedDensity)
 	{
-		double calculatedDensity = assumedDensity;
-		for (auto i = 0; i < 50; i++)
-		{
-			plane.gasDensity = calculatedDensity;
+		// sets the plane's flow at gasDensity and returns the density at the static pressure that leaves
+		auto const evaluate = [&plane, &calcDensity, mTotal](const double gasDensity) {
+			plane.gasDensity = gasDensity;
 			plane.gasVolumeFlowRate = mTotal / plane.gasDensity;
 			plane.gasVelocity = plane.gasVolumeFlowRate / plane.area;
 			plane.gasVelocityPressure = plane.gasDensity * std::pow(plane.gasVelocity / 1096, 2);
-			double fanInletOrOutletStaticPressure = plane.gasTotalPressure - plane.gasVelocityPressure;
-			double fanInletOrOutletGasDensity = calcDensity(plane, fanInletOrOutletStaticPressure);
+			plane.staticPressure = plane.gasTotalPressure - plane.gasVelocityPressure;
+			return calcDensity(plane, plane.staticPressure);
+		};
+
+		double calculatedDensity = assumedDensity;
+		for (auto i = 1; i <= 50;)
+		{
+			double const assumed = calculatedDensity;
+			double const next = evaluate(assumed);
+			if (fabs(next - assumed) < densityTolerance)
+			{
+				plane.gasDensity = next;
+				return i;
+			}
+			if (++i > 50)
+				break;
 
-			calculatedDensity = fanInletOrOutletGasDensity;
-			if (fabs(fanInletOrOutletGasDensity - plane.gasDensity) < 0.0001)
+			double const afterNext = evaluate(next);
+			if (fabs(afterNext - next) < densityTolerance)
 			{
-				plane.gasDensity = fanInletOrOutletGasDensity;
-				plane.staticPressure = fanInletOrOutletStaticPressure;
-				return;
+				plane.gasDensity = afterNext;
+				return i;
+			}
+			++i;
+
+			double const denominator = afterNext - 2 * next + assumed;
+			calculatedDensity = afterNext;
+			if (denominator != 0)
+			{
+				double const extrapolated = assumed - std::pow(next - assumed, 2) / denominator;
+				if (extrapolated > 0)
+					calculatedDensity = extrapolated;
 			}
 		}
 		throw std::runtime_error("In PlaneData::establishFanInletOrOutletDensity - density iteration did not converge");
@@ -586,7 +471,7 @@ private:
 		fanInletFlange.gasTotalPressure = inletMstPlane.gasTotalPressure - totalPressureLossBtwnPlanes1and4;
 
 		// steps 8 - 13
-		establishFanInletOrOutletDensity(fanInletFlange, calcDensity, mTotal, inletMstPlane.gasDensity);
+		fanInletFlangeIterations = establishFanInletOrOutletDensity(fanInletFlange, calcDensity, mTotal, inletMstPlane.gasDensity);
 
 		// calculating plane 2 inlet density and pressure
 		outletMstPlane.gasVolumeFlowRate = mTotal / outletMstPlane.gasDensity;
@@ -600,7 +485,7 @@ private:
 			(plane5upstreamOfPlane2) ? -totalPressureLossBtwnPlanes2and5 : totalPressureLossBtwnPlanes2and5;
 
 		// step 8 - iteration
-		establishFanInletOrOutletDensity(fanOrEvaseOutletFlange, calcDensity, mTotal, outletMstPlane.gasDensity);
+		fanOrEvaseOutletFlangeIterations = establishFanInletOrOutletDensity(fanOrEvaseOutletFlange, calcDensity, mTotal, outletMstPlane.gasDensity);
 	}
 
 	FlangePlane fanInletFlange, fanOrEvaseOutletFlange;
@@ -611,6 +496,9 @@ private:
 
 	bool const plane5upstreamOfPlane2;
 	const double totalPressureLossBtwnPlanes1and4, totalPressureLossBtwnPlanes2and5;
+	// largest change in fan inlet and outlet flange density, lb/scf, at which their iteration stops
+	double densityTolerance;
+	int fanInletFlangeIterations = 0, fanOrEvaseOutletFlangeIterations = 0;
 
 	friend class Fan203;
 	friend struct NodeBinding;
@@ -709,6 +597,22 @@ public:
 			fanTotalPressure * efficiency * 100, fanStaticPressure * efficiency * 100, staticPressureRise * efficiency * 100, {kpFactorRatio, fanShaftPower.getFanPowerInput(), planeData.fanInletFlange.gasVolumeFlowRate, fanTotalPressure, fanStaticPressure, staticPressureRise}, {kpc, hc, qc, ptc, psc, sprc}};
 	}
 
+	/**
+	 * Calculates many fan tests, e.g. all the traverses uploaded for a site
+	 * @param fans std::vector<Fan203>, the tests, their plane data already calculated on construction
+	 * @return std::vector<Output>, the output of each test, in order
+	 */
+	static std::vector<Output> calculate(std::vector<Fan203> &fans)
+	{
+		std::vector<Output> outputs;
+		outputs.reserve(fans.size());
+		for (auto &fan : fans)
+		{
+			outputs.push_back(fan.calculate());
+		}
+		return outputs;
+	}
+
 private:
 	double calculateCompressibilityFactor(const double x, const double z, const double isentropic)
 	{
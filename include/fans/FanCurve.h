@@ -8,6 +8,7 @@
  * @bug No known bugs.
  * 
  */
+#include <cstddef>
 #include <vector>
 /** 
  * enum class for Fan curve
@@ -140,12 +141,60 @@ public:
 			  curveData(std::move(data))
 	{};
 
+	/**
+	 * Corrected curve, one column per ResultData field
+	 */
+	struct ResultColumns {
+		std::vector<double> flow, pressure, power, efficiency;
+	};
+
 	std::vector<ResultData> calculate();
 
+	/**
+	 * Calculates the same corrected curve as calculate(), into columns. Rows whose compressibility iteration does
+	 * not converge in 7 iterations are left out, as calculate() does.
+	 * @return ResultColumns, corrected flow, pressure (per the curve type), power and efficiency
+	 */
+	ResultColumns calculateColumns();
+
 private:
-	std::vector<ResultData> calculateBaseCurve();
-	std::vector<ResultData> calculateBaseOperatingPoint();
-	std::vector<ResultData> calculateRatedPoint();
+	friend class FanCurveFamily;
+	friend class FanSystemEnergyModel;
+
+	/**
+	 * Terms of every row that do not depend on the correction, one column per term
+	 */
+	struct RowTerms {
+		std::vector<double> flow, pressure, power, density, speed, speedCorrected;
+		/// estimated total pressure, from pv1 and pv2 per the curve type
+		std::vector<double> estPt;
+		/// kp, eq 27, and pt1c over estPtc, eq 28
+		std::vector<double> kp, pt1cFactor;
+		std::vector<double> efficiency;
+	};
+
+	/**
+	 * Flow, pressure, estimated total pressure and power of every row times the speed and density ratios of a
+	 * correction, eq 17 to 20 without the kp / kpC factor
+	 */
+	struct CorrectedTerms {
+		std::vector<double> flowC, pressureC, estPtC, powerC;
+	};
+
+	RowTerms rowTerms() const;
+
+	/**
+	 * @param speedsCorrected std::vector<double>, corrected speed of each row
+	 * @param densityCorrected double, corrected density
+	 */
+	CorrectedTerms correct(const RowTerms &terms, const std::vector<double> &speedsCorrected,
+	                       double densityCorrected) const;
+
+	/**
+	 * Runs the kp / kpC iteration of all rows in lockstep, each row until it converges
+	 */
+	ResultColumns solve(const RowTerms &terms, const CorrectedTerms &corrected,
+	                    double pressureBarometricCorrected) const;
 
 	double density, densityCorrected, speed, speedCorrected, pressureBarometric, pressureBarometricCorrected;
 	double pt1Factor, gamma, gammaCorrected, area1, area2;
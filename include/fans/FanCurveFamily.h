@@ -0,0 +1,58 @@
+#ifndef AMO_TOOLS_SUITE_FANCURVEFAMILY_H
+#define AMO_TOOLS_SUITE_FANCURVEFAMILY_H
+/**
+ * @file
+ * @brief Family of corrected fan curves
+ * Contains the calculator for a family of fan curves corrected to many speeds, densities and barometric pressures
+ * @bug No known bugs.
+ *
+ */
+#include <vector>
+#include "FanCurve.h"
+
+/**
+ * Corrects one fan curve to many conditions, e.g. the speed settings of a retrofit study.
+ *
+ * The terms of each row that do not depend on the correction (pv1, pv2, the estimated total pressure, kp and the fan
+ * efficiency) are calculated once, when the family is constructed; each correction then only runs the kpC iteration.
+ * The curve of a correction is the same as that of a FanCurve constructed with the corrected speed, density and
+ * barometric pressure, and the corrected speed in every rated point or base operating point row.
+ */
+class FanCurveFamily {
+public:
+	/**
+	 * Conditions to correct the curve to
+	 */
+	struct Correction {
+		/// corrected speed in rpm, replaces the corrected speed of the curve and of every row
+		double speedCorrected;
+		/// corrected density in lb/scf
+		double densityCorrected;
+		/// corrected barometric pressure in in Hg
+		double pressureBarometricCorrected;
+	};
+
+	/**
+	 * Constructor
+	 * @param curve FanCurve, curve to correct; its corrected speed, density and barometric pressure are not used
+	 */
+	explicit FanCurveFamily(FanCurve curve);
+
+	/**
+	 * @param correction Correction, conditions to correct the curve to
+	 * @return FanCurve::ResultColumns, corrected curve, as FanCurve::calculateColumns
+	 */
+	FanCurve::ResultColumns calculate(const Correction &correction) const;
+
+	/**
+	 * @param corrections std::vector<Correction>, conditions to correct the curve to
+	 * @return std::vector<FanCurve::ResultColumns>, corrected curve of each correction
+	 */
+	std::vector<FanCurve::ResultColumns> calculate(const std::vector<Correction> &corrections) const;
+
+private:
+	FanCurve curve;
+	FanCurve::RowTerms terms;
+};
+
+#endif //AMO_TOOLS_SUITE_FANCURVEFAMILY_H
@@ -0,0 +1,139 @@
+#ifndef AMO_TOOLS_SUITE_FANSYSTEMENERGYMODEL_H
+#define AMO_TOOLS_SUITE_FANSYSTEMENERGYMODEL_H
+/**
+ * @file
+ * @brief Annual energy of a fan system over an airflow profile
+ * Contains the calculator for the energy a fan uses over a year of airflow, under outlet damper, inlet vane or VFD
+ * flow control
+ * @bug No known bugs.
+ *
+ */
+#include <cstddef>
+#include <vector>
+#include "FanCurve.h"
+#include "OptimalFanEfficiency.h"
+
+/**
+ * Energy a fan uses to deliver an airflow profile, e.g. for the savings of a VFD retrofit.
+ *
+ * The fan curve is corrected once, on construction, and interpolated linearly for every bin of a profile; its end
+ * segments are extended. The system curve is the static pressure plus a loss proportional to the flow squared, through
+ * the design point on the fan curve. At each flow rate of a profile:
+ * - an outlet damper leaves the fan at full speed, on its curve, throttling the difference to the system pressure;
+ * - inlet vanes scale the fan shaft power at the design point by the DOE-2 inlet vane part load curve, normalized to 1
+ *   at the design flow rate;
+ * - a VFD slows the fan until its curve, scaled by the fan laws, meets the system curve at that flow rate.
+ * Motor power is the fan shaft power through the belt, VFD (with a VFD only) and motor efficiencies, as FanShaftPower.
+ */
+class FanSystemEnergyModel {
+public:
+	enum class Control {
+		OutletDamper,
+		InletVanes,
+		VFD
+	};
+
+	/**
+	 * Hours of a year at one flow rate
+	 */
+	struct Bin {
+		/// flow rate in cfm, 0 when the fan is off
+		double flowRate;
+		/// hours at the flow rate
+		double hours;
+	};
+
+	/**
+	 * Operation of each bin of a profile, one column per field, and the totals of the profile
+	 */
+	struct Output {
+		/// fan speed over the speed of the curve, 1 without a VFD, 0 when the fan is off
+		std::vector<double> speedRatio;
+		/// fan pressure in inches of water (in WC), fan shaft power in hp, fan efficiency as fraction
+		std::vector<double> pressure, fanShaftPower, fanEfficiency;
+		/// motor power in kW and energy in kWh
+		std::vector<double> motorPower, energy;
+		/// fan energy index of each bin, 0 when the fan is off
+		std::vector<double> fanEnergyIndex;
+		/// hours of the profile, energy of the profile in kWh
+		double hours, annualEnergy;
+	};
+
+	/**
+	 * Constructor
+	 * @param curve FanCurve, curve of the fan, corrected to the speed and density it runs at
+	 * @param fanType OptimalFanEfficiency::FanType, type of fan, for the optimal efficiency at the design point, taken
+	 *        as incompressible
+	 * @param designFlowRate double, flow rate in cfm where the fan curve at full speed meets the system curve
+	 * @param systemStaticPressure double, pressure of the system curve at no flow in inches of water (in WC)
+	 * @param motorEfficiency double, motor efficiency as %
+	 * @param beltEfficiency double, belt efficiency as %, 100 for a direct drive
+	 * @param vfdEfficiency double, VFD efficiency as %, used with the VFD control
+	 * @throws std::runtime_error if the corrected curve has fewer than 2 rows or its flow rates are not increasing,
+	 *         the design flow rate is not positive, or the fan pressure at the design flow rate is not above the system
+	 *         static pressure
+	 */
+	FanSystemEnergyModel(FanCurve curve, OptimalFanEfficiency::FanType fanType, double designFlowRate,
+	                     double systemStaticPressure, double motorEfficiency, double beltEfficiency,
+	                     double vfdEfficiency);
+
+	/**
+	 * @param control Control, how the flow rate is controlled
+	 * @param profile std::vector<Bin>, hours at each flow rate
+	 * @return Output, operation of each bin and annual energy
+	 * @throws std::runtime_error if a flow rate is negative or above the design flow rate, or with a VFD, if the
+	 *         system curve meets the scaled fan curve beyond the end of the curve
+	 */
+	Output calculate(Control control, const std::vector<Bin> &profile) const;
+
+	/**
+	 * @param control Control, how the flow rate is controlled
+	 * @param hourlyFlowRates std::vector<double>, flow rate of each hour in cfm, e.g. the 8760 hours of a year
+	 * @return Output, operation of each hour and annual energy
+	 * @throws std::runtime_error as calculate(Control, const std::vector<Bin> &)
+	 */
+	Output calculate(Control control, const std::vector<double> &hourlyFlowRates) const;
+
+	/**
+	 * Speed ratio at which the fan curve scaled by the fan laws meets the system curve at a flow rate
+	 * @param flowRate double, flow rate in cfm, above 0 and up to the design flow rate
+	 * @return double, fan speed over the speed of the curve
+	 * @throws std::runtime_error if the system curve meets the scaled fan curve beyond the end of the curve, or the
+	 *         iteration does not converge
+	 */
+	double speedRatio(double flowRate) const;
+
+	/**
+	 * @return double, system pressure at a flow rate in cfm in inches of water (in WC)
+	 */
+	double systemPressure(double flowRate) const;
+
+	/**
+	 * @return double, fan efficiency at the design point as fraction, from the fan curve
+	 */
+	double getDesignFanEfficiency() const { return designFanEfficiency; }
+
+	/**
+	 * @return double, optimal efficiency of the fan type at the design point as fraction, from OptimalFanEfficiency
+	 */
+	double getOptimalFanEfficiency() const { return optimalFanEfficiency; }
+
+private:
+	/// index of the curve segment containing flowRate, the end segments extended
+	std::size_t segment(double flowRate) const;
+
+	/// interpolates a column of the curve at flowRate
+	double interpolate(const std::vector<double> &column, double flowRate) const;
+
+	/// pressure over flow rate of the curve segment containing flowRate
+	double pressureSlope(double flowRate) const;
+
+	FanCurve::ResultColumns curve;
+	double density, speed;
+	double designFlowRate, systemStaticPressure, lossCoefficient;
+	double designPower, designFanEfficiency, optimalFanEfficiency;
+	/// fan shaft power over motor power, with and without the VFD
+	double driveTrainEfficiency, driveTrainEfficiencyVFD;
+};
+
+#endif //AMO_TOOLS_SUITE_FANSYSTEMENERGYMODEL_H
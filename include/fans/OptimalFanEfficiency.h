@@ -8,6 +8,7 @@
 #ifndef AMO_TOOLS_SUITE_OPTIMALFANEFFICIENCY_H
 #define AMO_TOOLS_SUITE_OPTIMALFANEFFICIENCY_H
 
+#include <cmath>
 #include <functional>
 #include <cfloat>
 /**
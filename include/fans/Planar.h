@@ -7,8 +7,72 @@
  */
 #ifndef AMO_TOOLS_SUITE_PLANAR_H
 #define AMO_TOOLS_SUITE_PLANAR_H
-#include <vector>
 #include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Velocity pressure readings of a traverse in one contiguous buffer, row by row. The reading of a row and column is at
+ * row * stride + column; a stride above the column count leaves unused readings at the end of each row.
+ */
+class TraverseGrid {
+public:
+	/**
+	 * @param rows std::size_t, number of traverse rows (ports)
+	 * @param columns std::size_t, number of readings per row
+	 * @param readings std::vector<double>, velocity pressure readings in inches of water (in WC), row by row
+	 * @param stride std::size_t, distance between the first readings of two rows, 0 for columns
+	 * @throws std::runtime_error if the grid is empty or readings does not hold rows of stride readings
+	 */
+	TraverseGrid(const std::size_t rows, const std::size_t columns, std::vector<double> readings,
+	             const std::size_t stride = 0)
+			: rows(rows), columns(columns), stride(stride ? stride : columns), readings(std::move(readings))
+	{
+		if (!rows || !columns || this->stride < columns) {
+			throw std::runtime_error("TraverseGrid: a traverse needs at least one row and column of readings");
+		}
+		if (this->readings.size() < (rows - 1) * this->stride + columns) {
+			throw std::runtime_error("TraverseGrid: fewer readings than rows and columns of the traverse");
+		}
+	}
+
+	/**
+	 * @param traverseHoleData std::vector<std::vector<double>>, readings of each row in inches of water (in WC)
+	 * @throws std::runtime_error if there are no readings or the rows differ in length
+	 */
+	explicit TraverseGrid(const std::vector< std::vector< double > > & traverseHoleData)
+			: TraverseGrid(traverseHoleData.size(), traverseHoleData.empty() ? 0 : traverseHoleData[0].size(),
+			               flatten(traverseHoleData))
+	{}
+
+	std::size_t getRows() const { return rows; }
+	std::size_t getColumns() const { return columns; }
+	std::size_t getStride() const { return stride; }
+
+	double operator()(const std::size_t row, const std::size_t column) const {
+		return readings[row * stride + column];
+	}
+
+private:
+	static std::vector<double> flatten(const std::vector< std::vector< double > > & traverseHoleData) {
+		std::vector<double> readings;
+		if (traverseHoleData.empty()) return readings;
+		readings.reserve(traverseHoleData.size() * traverseHoleData[0].size());
+		for (auto const & row : traverseHoleData) {
+			if (row.size() != traverseHoleData[0].size()) {
+				throw std::runtime_error("TraverseGrid: every traverse row needs the same number of readings");
+			}
+			readings.insert(readings.end(), row.begin(), row.end());
+		}
+		return readings;
+	}
+
+	std::size_t rows, columns, stride;
+	std::vector<double> readings;
+
+	friend class VelocityPressureTraverseData;
+};
 
 // to be inherited by planes 3 and 3a, 3b
 class VelocityPressureTraverseData {
@@ -24,40 +88,52 @@ protected:
 	// protected constructor to be used only during the construction of its derived classes
 	VelocityPressureTraverseData(const double pitotTubeCoefficient,
 	                             std::vector< std::vector< double > > traverseHoleData)
-			: pitotTubeCoefficient(pitotTubeCoefficient), traverseHoleData(std::move(traverseHoleData))
+			: VelocityPressureTraverseData(pitotTubeCoefficient, TraverseGrid(traverseHoleData))
+	{}
+
+	VelocityPressureTraverseData(const double pitotTubeCoefficient, TraverseGrid traverseGrid)
+			: pitotTubeCoefficient(pitotTubeCoefficient), traverseGrid(std::move(traverseGrid))
 	{
+		auto & grid = this->traverseGrid;
+		double const coefficient2 = std::pow(pitotTubeCoefficient, 2);
 		double maxPv3r = 0.0;
 		double sumPv3r = 0.0;
-		for (auto & row : this->traverseHoleData) {
-			for (double & val : row) {
+		// one pass corrects each reading for the pitot tube and sums its root, row by row as the traverse was taken
+		for (std::size_t r = 0; r < grid.rows; r++) {
+			double * const row = grid.readings.data() + r * grid.stride;
+			for (std::size_t c = 0; c < grid.columns; c++) {
+				double & val = row[c];
 				if (val <= 0) {
 					val = 0;
 					continue;
 				}
-				val *= std::pow(pitotTubeCoefficient, 2);
-				if (val > maxPv3r) {
-					maxPv3r = val;
-				}
+				val *= coefficient2;
+				if (val > maxPv3r) maxPv3r = val;
 				sumPv3r += std::sqrt(val);
 			}
 		}
 
-		pv3 = std::pow(sumPv3r / (this->traverseHoleData.size() * this->traverseHoleData[0].size()), 2);
+		std::size_t const readingCount = grid.rows * grid.columns;
+		pv3 = std::pow(sumPv3r / readingCount, 2);
 
+		// the 75% rule compares against the largest reading, so it counts once that is known
+		double const threshold = 0.1 * maxPv3r;
 		std::size_t count = 0;
-		for (auto & row : this->traverseHoleData) {
-			for (auto & val : row) {
-				if (val > (0.1 * maxPv3r)) count++;
+		for (std::size_t r = 0; r < grid.rows; r++) {
+			double const * const row = grid.readings.data() + r * grid.stride;
+			for (std::size_t c = 0; c < grid.columns; c++) {
+				count += row[c] > threshold;
 			}
 		}
 
-		percent75Rule = count / static_cast<double>(this->traverseHoleData.size() * this->traverseHoleData[0].size());
+		percent75Rule = count / static_cast<double>(readingCount);
 	}
 
 	double pitotTubeCoefficient;
 	double pv3 = 0, percent75Rule = 0;
 
-	std::vector< std::vector< double > > traverseHoleData;
+	/// readings corrected for the pitot tube coefficient, readings at or below 0 set to 0
+	TraverseGrid traverseGrid;
 
 	friend class PlaneData;
 };
@@ -96,6 +172,12 @@ public:
 			: Planar(area, tdx, pbx, psx),
 			  VelocityPressureTraverseData(pitotTubeCoefficient, std::move(traverseHoleData))
 	{}
+
+	TraversePlane(const double area, const double tdx, const double pbx, const double psx,
+				  const double pitotTubeCoefficient, TraverseGrid traverseGrid)
+			: Planar(area, tdx, pbx, psx),
+			  VelocityPressureTraverseData(pitotTubeCoefficient, std::move(traverseGrid))
+	{}
 };
 
 class MstPlane : public Planar {
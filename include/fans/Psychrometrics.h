@@ -0,0 +1,105 @@
+#ifndef AMO_TOOLS_SUITE_PSYCHROMETRICS_H
+#define AMO_TOOLS_SUITE_PSYCHROMETRICS_H
+/**
+ * @file
+ * @brief Psychrometric properties of moist air
+ * Saturation pressure, humidity ratio, wet bulb temperature and dew point as used by BaseGasDensity, with batch
+ * versions for many readings at the same absolute pressure.
+ * @bug No known bugs.
+ *
+ */
+#include <cstddef>
+#include <vector>
+
+class Psychrometrics {
+public:
+	/**
+	 * @param temperature double, temperature in °F
+	 * @return double, saturation pressure of water vapor in Hg, over ice below 32 °F
+	 */
+	static double saturationPressure(double temperature);
+
+	/**
+	 * @param temperature double, temperature in °F
+	 * @return double, derivative of the saturation pressure with respect to temperature in Hg/°F
+	 */
+	static double saturationPressureDerivative(double temperature);
+
+	/**
+	 * @param dryBulbTemp double, temperature in °F
+	 * @param relativeHumidity double, relative humidity as fraction
+	 * @param absolutePressure double, pressure in Hg
+	 * @param specificGravity double, specific gravity of the gas, unitless
+	 * @return double, humidity ratio, unitless
+	 */
+	static double humidityRatio(double dryBulbTemp, double relativeHumidity, double absolutePressure,
+	                            double specificGravity = 1);
+
+	/**
+	 * @param dryBulbTemp double, temperature in °F
+	 * @param wetBulbTemp double, wet bulb temperature in °F
+	 * @param absolutePressure double, pressure in Hg
+	 * @param cpGas double, specific heat of the gas in BTU/lb-°F
+	 * @return double, humidity ratio, unitless
+	 */
+	static double humidityRatioFromWetBulb(double dryBulbTemp, double wetBulbTemp, double absolutePressure,
+	                                       double cpGas);
+
+	/**
+	 * @return double, derivative of humidityRatioFromWetBulb with respect to the wet bulb temperature in 1/°F
+	 */
+	static double humidityRatioFromWetBulbDerivative(double dryBulbTemp, double wetBulbTemp, double absolutePressure,
+	                                                 double cpGas);
+
+	/**
+	 * @param dryBulbTemp double, temperature in °F
+	 * @param wetBulbTemp double, wet bulb temperature in °F
+	 * @param absolutePressure double, pressure in Hg
+	 * @param cpGas double, specific heat of the gas in BTU/lb-°F
+	 * @return double, relative humidity as fraction
+	 */
+	static double relativeHumidityFromWetBulb(double dryBulbTemp, double wetBulbTemp, double absolutePressure,
+	                                          double cpGas);
+
+	/**
+	 * Solves humidityRatioFromWetBulb for the wet bulb temperature giving the humidity ratio of the air, to within
+	 * 0.001% of it (to within 0.00001 of dry air). Newton steps with the analytic derivative, from the dry bulb
+	 * temperature, fall back to bisection of a bracket of the root when they would leave it.
+	 * @param dryBulbTemp double, temperature in °F
+	 * @param relativeHumidity double, relative humidity as fraction
+	 * @param absolutePressure double, pressure in Hg
+	 * @param cpGas double, specific heat of the gas in BTU/lb-°F
+	 * @return double, wet bulb temperature in °F
+	 * @throws std::runtime_error if the wet bulb temperature can not be bracketed or does not converge
+	 */
+	static double wetBulbTemperature(double dryBulbTemp, double relativeHumidity, double absolutePressure,
+	                                 double cpGas = 0.24);
+
+	/**
+	 * Dew point correlation of the ASHRAE Handbook of Fundamentals, the ice branch used below 32 °F dry bulb
+	 * @param dryBulbTemp double, temperature in °F
+	 * @param humidityRatio double, humidity ratio, unitless
+	 * @param absolutePressure double, pressure in Hg
+	 * @return double, dew point in °F
+	 */
+	static double dewPoint(double dryBulbTemp, double humidityRatio, double absolutePressure);
+
+	/**
+	 * Batch versions, one result per temperature. The dry bulb and humidity inputs must be the same size.
+	 * @throws std::runtime_error if the inputs differ in size
+	 */
+	static std::vector<double> saturationPressure(const std::vector<double> &temperatures);
+
+	static std::vector<double> humidityRatio(const std::vector<double> &dryBulbTemps,
+	                                         const std::vector<double> &relativeHumidities, double absolutePressure,
+	                                         double specificGravity = 1);
+
+	static std::vector<double> wetBulbTemperature(const std::vector<double> &dryBulbTemps,
+	                                              const std::vector<double> &relativeHumidities,
+	                                              double absolutePressure, double cpGas = 0.24);
+
+	static std::vector<double> dewPoint(const std::vector<double> &dryBulbTemps,
+	                                    const std::vector<double> &humidityRatios, double absolutePressure);
+};
+
+#endif //AMO_TOOLS_SUITE_PSYCHROMETRICS_H
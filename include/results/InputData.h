@@ -38,6 +38,15 @@ struct Motor {
 		CURRENT
 	};
 
+	/**
+	 * How MotorShaftPower and OptimalMotorPower find the 1% load step the measured value falls in; BISECTION
+	 * assumes the stepped curve is increasing and evaluates about 8 load steps instead of up to 150
+	 */
+	enum class LoadSolver {
+		STEP,
+		BISECTION
+	};
+
 	/**
 	 * Constructor
 	 * @param lineFrequency LineFrequency, main supply frequency at either 50Hz or 60Hz
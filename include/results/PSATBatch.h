@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @brief Batched PSAT existing and modified results
+ *
+ * This contains the prototypes of the PSATBatch, which evaluates PSATResult for many pumps at once.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_LIBRARY_PSATBATCH_H
+#define AMO_LIBRARY_PSATBATCH_H
+
+#include <vector>
+#include "InputData.h"
+
+/**
+ * Calculates the PSAT existing and modified results of a fleet of pumps.
+ *
+ * Inputs and outputs are column vectors with one entry per pump. Pumps with identical motors (line frequency, rated
+ * power, rpm, efficiency class, specified efficiency, rated voltage and full load amps) share one MotorCurveSet, so
+ * the motor part load curves are calculated once per distinct motor rather than once per pump. Results are the same
+ * as those of PSATResult::calculateExisting and PSATResult::calculateModified.
+ */
+class PSATBatch {
+public:
+    /// Column vectors of the PSATResult constructor arguments, see Pump::Input, Motor and Pump::FieldData
+    struct Input {
+        std::vector<Pump::Style> style;
+        std::vector<double> pumpEfficiency, pumpRpm;
+        std::vector<Motor::Drive> drive;
+        std::vector<double> kinematicViscosity, specificGravity;
+        std::vector<int> stageCount;
+        std::vector<Pump::SpecificSpeed> fixedSpeed;
+        std::vector<double> driveEfficiency; ///< Pump::Input specifiedEfficiency, used with Motor::Drive::SPECIFIED
+
+        std::vector<Motor::LineFrequency> lineFrequency;
+        std::vector<double> motorRatedPower, motorRpm;
+        std::vector<Motor::EfficiencyClass> efficiencyClass;
+        std::vector<double> motorSpecifiedEfficiency, motorRatedVoltage, fullLoadAmps;
+
+        std::vector<double> flowRate, head;
+        std::vector<Motor::LoadEstimationMethod> loadEstimationMethod;
+        std::vector<double> motorPower, motorAmps, voltage;
+
+        std::vector<double> operatingHours, unitCost;
+
+        /**
+         * Appends a pump
+         * @param pump Pump::Input, pump data
+         * @param motor Motor, motor data
+         * @param fieldData Pump::FieldData, measured data
+         * @param operatingHours double, annual operating hours
+         * @param unitCost double, cost of electricity per kWh
+         */
+        void add(const Pump::Input &pump, const Motor &motor, const Pump::FieldData &fieldData, double operatingHours,
+                 double unitCost);
+
+        /**
+         * Reserves room for a number of pumps in every column
+         * @param count std::size_t, number of pumps
+         */
+        void reserve(std::size_t count);
+
+        /**
+         * @return std::size_t, number of pumps
+         * @throws std::runtime_error if the columns are not all the same size
+         */
+        std::size_t size() const;
+    };
+
+    /// Column vectors of PSATResult::Output
+    struct Output {
+        std::vector<double> pumpEfficiency, motorRatedPower, motorShaftPower, pumpShaftPower, motorEfficiency;
+        std::vector<double> motorPowerFactor, motorCurrent, motorPower, annualEnergy, annualCost, loadFactor;
+        std::vector<double> driveEfficiency, estimatedFLA;
+
+        std::size_t size() const { return pumpEfficiency.size(); }
+
+    private:
+        friend class PSATBatch;
+        void resize(std::size_t count);
+        void set(std::size_t i, double pumpEfficiency, double motorRatedPower, double motorShaftPower,
+                 double pumpShaftPower, double motorEfficiency, double motorPowerFactor, double motorCurrent,
+                 double motorPower, double annualEnergy, double annualCost, double loadFactor, double driveEfficiency,
+                 double estimatedFLA);
+    };
+
+    struct Result {
+        Output existing, modified;
+        std::size_t motorGroupCount; ///< number of distinct motors, i.e. of MotorCurveSets calculated
+    };
+
+    /**
+     * Constructor
+     * @param loadSolver Motor::LoadSolver, how MotorShaftPower and OptimalMotorPower find the motor load
+     */
+    explicit PSATBatch(Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP) : loadSolver(loadSolver) {}
+
+    /**
+     * Calculates the existing and modified results of every pump
+     * @param input Input, one entry per pump in each column
+     * @return Result, one entry per pump in each column, in input order
+     * @throws std::runtime_error if the input columns are not all the same size
+     */
+    Result calculate(const Input &input) const;
+
+private:
+    Motor::LoadSolver loadSolver;
+};
+
+#endif //AMO_LIBRARY_PSATBATCH_H
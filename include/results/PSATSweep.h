@@ -0,0 +1,104 @@
+/**
+ * @file
+ * @brief PSAT existing and modified results over a grid of operating points
+ *
+ * This contains the prototypes of the PSATSweep, which evaluates PSATResult for one pump and motor over a grid of
+ * flow rates, heads and motor load factors.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_LIBRARY_PSATSWEEP_H
+#define AMO_LIBRARY_PSATSWEEP_H
+
+#include <vector>
+#include "Results.h"
+#include "calculator/motor/MotorCurveSet.h"
+
+/**
+ * Calculates PSATResult existing and modified results of one pump and motor over a grid of flow rates, heads and
+ * load factors, e.g. for savings surfaces and duty cycle weighted savings.
+ *
+ * Each load factor is turned into the measured motor power (POWER load estimation) at which the motor runs at that
+ * load. The motor curves are calculated once; the existing motor and drive results are calculated once per load
+ * factor, as only the pump efficiency depends on flow rate and head, and the modified results once per flow rate and
+ * head pair, as they do not depend on the measured motor power. Results are the same as those of PSATResult for the
+ * same field data.
+ */
+class PSATSweep {
+public:
+    struct Output {
+        std::vector<double> flowRates, heads, loadFactors;
+        /// measured motor power in kW of each load factor
+        std::vector<double> motorPowers;
+        /// results of every grid point, see index()
+        std::vector<PSATResult::Output> existing, modified;
+
+        /**
+         * @param flow std::size_t, index into flowRates
+         * @param head std::size_t, index into heads
+         * @param load std::size_t, index into loadFactors
+         * @return std::size_t, index of the grid point into existing and modified
+         */
+        std::size_t index(std::size_t flow, std::size_t head, std::size_t load) const {
+            return (flow * heads.size() + head) * loadFactors.size() + load;
+        }
+
+        /**
+         * @param i std::size_t, grid point index
+         * @return double, existing minus modified annual cost at the grid point
+         */
+        double annualSavings(std::size_t i) const {
+            return existing[i].annualCost - modified[i].annualCost;
+        }
+
+        /**
+         * Duty cycle weighted annual savings
+         * @param weights std::vector<double>, fraction of the operating hours spent at each grid point, in grid point
+         *        order; usually summing to 1
+         * @return double, weighted sum of the annual savings
+         * @throws std::runtime_error if there is not one weight per grid point
+         */
+        double weightedAnnualSavings(const std::vector<double> &weights) const;
+    };
+
+    /**
+     * Constructor
+     * @param pumpInput Pump::Input, pump data
+     * @param motor Motor, motor data
+     * @param fieldVoltage double, measured motor voltage in volts
+     * @param operatingHours double, annual operating hours
+     * @param unitCost double, cost of electricity per kWh
+     * @param loadSolver Motor::LoadSolver, how MotorShaftPower and OptimalMotorPower find the motor load
+     */
+    PSATSweep(const Pump::Input &pumpInput, const Motor &motor, double fieldVoltage, double operatingHours,
+              double unitCost, Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP);
+
+    /**
+     * Calculates the results over the grid
+     * @param flowRates std::vector<double>, flow rates in gpm
+     * @param heads std::vector<double>, heads in ft
+     * @param loadFactors std::vector<double>, motor load factors - unitless, greater than 0
+     * @return Output, results of every combination of flow rate, head and load factor
+     */
+    Output calculate(const std::vector<double> &flowRates, const std::vector<double> &heads,
+                     const std::vector<double> &loadFactors) const;
+
+    /**
+     * Measured motor power at which the motor runs at a load factor
+     * @param loadFactor double, motor load factor - unitless, greater than 0
+     * @return double, electric power in kW
+     */
+    double motorPower(double loadFactor) const;
+
+    const MotorCurveSet & getMotorCurves() const { return curves; }
+
+private:
+    Pump::Input pumpInput;
+    MotorCurveSet curves;
+    double fieldVoltage, operatingHours, unitCost;
+    Motor::LoadSolver loadSolver;
+};
+
+#endif //AMO_LIBRARY_PSATSWEEP_H
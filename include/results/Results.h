@@ -166,6 +166,34 @@ public:
   Output calculateExisting();
   Output calculateModified();
 
+  /**
+   * Existing results of a pump from the precomputed curves of its motor, as calculated by calculateExisting()
+   * @param curves MotorCurveSet, curves of the pump's motor
+   * @param pumpInput Pump::Input, pump data
+   * @param fieldData Pump::FieldData, measured data
+   * @param operatingHours double, annual operating hours
+   * @param unitCost double, cost of electricity per kWh
+   * @param loadSolver Motor::LoadSolver, how the motor load is found
+   * @return Output, existing results
+   */
+  static Output existingFromCurves(const MotorCurveSet &curves, const Pump::Input &pumpInput,
+                                   const Pump::FieldData &fieldData, double operatingHours, double unitCost,
+                                   Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP);
+
+  /**
+   * Modified results of a pump from the precomputed curves of its motor, as calculated by calculateModified()
+   * @param curves MotorCurveSet, curves of the pump's motor
+   * @param pumpInput Pump::Input, pump data
+   * @param fieldData Pump::FieldData, measured data
+   * @param operatingHours double, annual operating hours
+   * @param unitCost double, cost of electricity per kWh
+   * @param loadSolver Motor::LoadSolver, how the motor load is found
+   * @return Output, modified results
+   */
+  static Output modifiedFromCurves(const MotorCurveSet &curves, const Pump::Input &pumpInput,
+                                   const Pump::FieldData &fieldData, double operatingHours, double unitCost,
+                                   Motor::LoadSolver loadSolver = Motor::LoadSolver::STEP);
+
 private:
   // Out values
   Output existing, modified;
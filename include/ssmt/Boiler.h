@@ -147,6 +147,11 @@ public:
 private:
     void calculateProperties();
 
+    friend class SteamModelerSerializer;
+
+    /// Restores an already calculated Boiler without recalculating, see SteamModelerSerializer
+    Boiler() = default;
+
     double deaeratorPressure, combustionEfficiency, blowdownRate, steamPressure;
     SteamProperties::ThermodynamicQuantity quantityType;
     double quantityValue, steamMassFlow;
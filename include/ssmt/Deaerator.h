@@ -43,6 +43,25 @@ public:
               double waterQuantityValue, double steamPressure,
               SteamProperties::ThermodynamicQuantity steamQuantityType, double steamQuantityValue);
 
+    /**
+     *
+     * Constructor for the deaerator calculator from already calculated states, no steam properties are evaluated.
+     * Used by the steam modeler, which has the inlet water and inlet steam states from the headers feeding the
+     * deaerator and reuses the saturated properties at deaerator pressure between iterations.
+     *
+     * @param deaeratorPressure double, deaerator pressure in MPa
+     * @param ventRate double, vent rate as %
+     * @param feedwaterMassFlow double, mass flow of the feedwater in kg/hr
+     * @param saturatedProperties SteamSystemModelerTool::SaturatedPropertiesOutput, saturated properties at deaerator pressure
+     * @param inletWaterProperties SteamSystemModelerTool::SteamPropertiesOutput, properties of the inlet water
+     * @param inletSteamProperties SteamSystemModelerTool::SteamPropertiesOutput, properties of the inlet steam
+     *
+     * */
+    Deaerator(double deaeratorPressure, double ventRate, double feedwaterMassFlow,
+              const SteamSystemModelerTool::SaturatedPropertiesOutput &saturatedProperties,
+              const SteamSystemModelerTool::SteamPropertiesOutput &inletWaterProperties,
+              const SteamSystemModelerTool::SteamPropertiesOutput &inletSteamProperties);
+
     friend std::ostream &operator<<(std::ostream &stream, const Deaerator &deaerator);
 
 	/**
@@ -181,6 +200,15 @@ private:
 
     void calculateProperties();
 
+    void calculateProperties(const SteamSystemModelerTool::SaturatedPropertiesOutput &sp,
+                             const SteamSystemModelerTool::SteamPropertiesOutput &inletWaterProps,
+                             const SteamSystemModelerTool::SteamPropertiesOutput &inletSteamProps);
+
+    friend class SteamModelerSerializer;
+
+    /// Restores an already calculated Deaerator without recalculating, see SteamModelerSerializer
+    Deaerator() = default;
+
 
     double deaeratorPressure, ventRate, feedwaterMassFlow, waterPressure, waterQuantityValue;
     double steamPressure, steamQuantityValue;
@@ -114,6 +114,11 @@ public:
 private:
     void calculateProperties();
 
+    friend class SteamModelerSerializer;
+
+    /// Restores an already calculated FlashTank without recalculating, see SteamModelerSerializer
+    FlashTank() = default;
+
     double inletWaterPressure, quantityValue, inletWaterMassFlow, tankPressure;
     SteamProperties::ThermodynamicQuantity quantityType;
 
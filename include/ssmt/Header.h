@@ -18,6 +18,14 @@ public:
 	* */
 	Inlet(double pressure, SteamProperties::ThermodynamicQuantity quantityType, double quantityValue, double massFlow);
 
+	/**
+	 * Constructor for an Inlet whose steam properties are already calculated, the properties are used as is
+	 *
+	 * @param inletProperties SteamSystemModelerTool::SteamPropertiesOutput, calculated properties of the inlet
+	 * @param massFlow double, inlet mass flow in kg/hr
+	 * */
+	Inlet(const SteamSystemModelerTool::SteamPropertiesOutput &inletProperties, double massFlow);
+
 	double getPressure() const { return pressure; }
 	double getQuantityValue() const { return quantityValue; }
 	double getMassFlow() const { return massFlow; }
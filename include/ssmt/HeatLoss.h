@@ -10,6 +10,7 @@
  */
 
 #include <iostream>
+#include <vector>
 #include "SteamProperties.h"
 #include "SteamSystemModelerTool.h"
 
@@ -34,6 +35,48 @@ public:
     HeatLoss(double inletPressure, SteamProperties::ThermodynamicQuantity quantityType, double quantityValue,
              double inletMassFlow, double percentHeatLoss);
 
+    /**
+     * Fast path constructor for repeated heat loss calculations, e.g. a header on every steam model restart iteration.
+     * If the inlet pressure, quantity and percent heat loss match the previous calculation, the previous inlet and
+     * outlet steam properties are reused and only the mass and energy flows are recalculated; otherwise the
+     * properties are calculated as usual.
+     *
+     * @param previous HeatLoss, previously calculated heat loss for the same header or pipe segment
+     * @param inletPressure double, inlet pressure in MPa
+     * @param quantityType SteamProperties::ThermodynamicQuantity, type of quantity (either temperature in K, enthalpy in kJ/kg, entropy in kJ/kg/K, or quality - unitless)
+     * @param quantityValue double, value of the quantity (either temperature in K, enthalpy in kJ/kg, entropy in kJ/kg/K, or quality - unitless)
+     * @param inletMassFlow double, inlet mass flow in kg/hr
+     * @param percentHeatLoss double, heat loss as %
+     */
+    HeatLoss(const HeatLoss &previous, double inletPressure, SteamProperties::ThermodynamicQuantity quantityType,
+             double quantityValue, double inletMassFlow, double percentHeatLoss);
+
+    /**
+     * Input for a single header or pipe segment of a batched heat loss calculation
+     * @param inletPressure double, inlet pressure in MPa
+     * @param quantityType SteamProperties::ThermodynamicQuantity, type of quantity (either temperature in K, enthalpy in kJ/kg, entropy in kJ/kg/K, or quality - unitless)
+     * @param quantityValue double, value of the quantity (either temperature in K, enthalpy in kJ/kg, entropy in kJ/kg/K, or quality - unitless)
+     * @param inletMassFlow double, inlet mass flow in kg/hr
+     * @param percentHeatLoss double, heat loss as %
+     */
+    struct Input {
+        double inletPressure;
+        SteamProperties::ThermodynamicQuantity quantityType;
+        double quantityValue, inletMassFlow, percentHeatLoss;
+    };
+
+    /**
+     * Calculates the heat loss for many header or pipe segments at once. Each segment reuses the steam properties of
+     * its entry in previous (when previous has one entry per segment) or of the preceding segment when the inlet
+     * state and percent heat loss are unchanged.
+     *
+     * @param segments std::vector<HeatLoss::Input>, inputs for each segment
+     * @param previous std::vector<HeatLoss>, results of the previous batch for the same segments, may be empty
+     * @return std::vector<HeatLoss>, heat loss for each segment
+     */
+    static std::vector<HeatLoss> calculate(const std::vector<Input> &segments,
+                                           const std::vector<HeatLoss> &previous = std::vector<HeatLoss>());
+
     friend std::ostream &operator<<(std::ostream &stream, const HeatLoss &heatLoss);
 
     /**
@@ -84,6 +127,12 @@ public:
 	 */
     SteamProperties::ThermodynamicQuantity getQuantityType() const { return quantityType; };
 
+    /**
+     * Gets whether the steam properties were reused from a previous calculation
+     * @return bool, true if the fast path reused the previous inlet and outlet steam properties
+     */
+    bool isReusedFromPrevious() const { return reusedFromPrevious; };
+
     /**
 	 * Sets the inlet pressure
 	 * @param inletPressure double, pressure of the inlet steam in MPa
@@ -117,6 +166,16 @@ public:
 private:
     void calculateProperties();
 
+    bool canReuse(const HeatLoss &previous) const;
+
+    void setFlows(const SteamSystemModelerTool::SteamPropertiesOutput &inletSteam,
+                  const SteamSystemModelerTool::SteamPropertiesOutput &outletSteam);
+
+    friend class SteamModelerSerializer;
+
+    /// Restores an already calculated HeatLoss without recalculating, see SteamModelerSerializer
+    HeatLoss() = default;
+
     double inletPressure, quantityValue, inletMassFlow, percentHeatLoss;
     SteamSystemModelerTool::FluidProperties inletProperties;
     double inletEnergyFlow, outletEnergyFlow;
@@ -124,6 +183,7 @@ private:
 
     double heatLoss;
     SteamProperties::ThermodynamicQuantity quantityType;
+    bool reusedFromPrevious = false;
 };
 
 #endif //AMO_TOOLS_SUITE_HEATLOSS_H
@@ -170,6 +170,11 @@ public:
 protected:
     virtual void calculateProperties();
 
+    friend class SteamModelerSerializer;
+
+    /// Restores an already calculated PRV without recalculating, see SteamModelerSerializer
+    PrvWithoutDesuperheating() = default;
+
     double inletPressure, quantityValue, inletMassFlow, outletPressure;
     SteamSystemModelerTool::SteamPropertiesOutput inletProperties, outletProperties;
     SteamProperties::ThermodynamicQuantity quantityType;
@@ -331,6 +336,11 @@ public:
 protected:
     void calculateProperties() override;
 
+    friend class SteamModelerSerializer;
+
+    /// Restores an already calculated PRV without recalculating, see SteamModelerSerializer
+    PrvWithDesuperheating() = default;
+
 private:
     // In values
     double feedwaterPressure, feedwaterQuantityValue, desuperheatingTemp;
@@ -39,6 +39,13 @@ public:
      */
      SteamSystemModelerTool::SteamPropertiesOutput calculate();
 
+	/**
+	 * Number of times calculate() has been called on the current thread, used to measure how many steam property
+	 * evaluations a model run needs.
+	 * @return The running count of calculate() calls on this thread.
+	 */
+	static unsigned long long getCalculationCount();
+
 private:
     /**
      * Calculates the steam properties using temperature
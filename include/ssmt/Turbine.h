@@ -256,6 +256,11 @@ public:
 	void setTurbineProperty(TurbineProperty turbineProperty);
 
 private:
+	friend class SteamModelerSerializer;
+
+	/// Restores an already calculated Turbine without recalculating, see SteamModelerSerializer
+	Turbine() = default;
+
 	/**
 	 * @param calculate, calculates the needed value
 	 * 
@@ -1,6 +1,7 @@
 #ifndef AMO_TOOLS_SUITE_STEAMMODELER_H
 #define AMO_TOOLS_SUITE_STEAMMODELER_H
 
+#include "SteamModelerCache.h"
 #include "SteamModelerInput.h"
 #include "SteamModelerOutput.h"
 #include <ssmt/domain/SteamModelCalculationsDomain.h>
@@ -15,11 +16,22 @@ class SteamModeler {
 public:
     /**
      * Entry into the Steam Modeler using a SteamModelerInput object.
+     * Results are taken from and stored in SteamModelerCache::instance() when that cache is enabled.
      * @param steamModelerInput The object containing the Steam Modeler data for processing.
      * @return The Steam Modeler processing results.
      */
     SteamModelerOutput model(const SteamModelerInput &steamModelerInput);
 
+    /**
+     * Entry into the Steam Modeler that also reports how the system balance converged; always runs the model,
+     * SteamModelerCache::instance() is not consulted.
+     * @param steamModelerInput The object containing the Steam Modeler data for processing.
+     * @param trace Receives one entry per attempt at balancing the system, see SteamModelRunner::run.
+     * @return The Steam Modeler processing results.
+     * @throws SteamBalanceConvergenceException with the same trace when the system does not balance.
+     */
+    SteamModelerOutput model(const SteamModelerInput &steamModelerInput, SteamBalanceTrace &trace);
+
 private:
     /**
      * Entry into the Steam Modeler using individual data objects.
@@ -29,11 +41,13 @@ private:
      * @param boilerInput The boiler input data.
      * @param turbineInput All of the turbines input data.
      * @param operationsInput The operational input data.
+     * @param trace Receives the convergence trace of the system balancing.
      * @return The Steam Modeler processing results.
      */
     SteamModelerOutput
     modeler(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
-          const BoilerInput &boilerInput, const TurbineInput &turbineInput, const OperationsInput &operationsInput);
+          const BoilerInput &boilerInput, const TurbineInput &turbineInput, const OperationsInput &operationsInput,
+          SteamBalanceTrace &trace);
 
     SteamModelRunner steamModelRunner = SteamModelRunner();
     SteamModelerOutputFactory steamModelerOutputFactory = SteamModelerOutputFactory();
@@ -41,7 +55,7 @@ private:
     SteamModelCalculationsDomain
     runModel(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
              const BoilerInput &boilerInput, const TurbineInput &turbineInput,
-             const OperationsInput &operationsInput) const;
+             const OperationsInput &operationsInput, SteamBalanceTrace &trace) const;
 
     SteamModelerOutput makeOutput(const SteamModelCalculationsDomain &steamModelCalculationsDomain) const;
 
@@ -0,0 +1,107 @@
+#ifndef AMO_TOOLS_SUITE_STEAMMODELERCACHE_H
+#define AMO_TOOLS_SUITE_STEAMMODELERCACHE_H
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "SteamModelerInput.h"
+#include "SteamModelerOutput.h"
+#include "SteamModelerSerializer.h"
+
+/**
+ * Least recently used cache of Steam Modeler results, keyed by the canonicalized input.
+ *
+ * The key is the SteamModelerSerializer representation of the input after canonicalization (turbines that are not
+ * in use are reduced to a fixed placeholder, since their values do not affect the model). Results are stored in
+ * their serialized form so that every hit returns an independent copy and the memory used can be accounted exactly.
+ * All methods are thread safe.
+ */
+class SteamModelerCache {
+public:
+    /**
+     * Cache usage counters.
+     * @param hits Number of lookups that returned a stored result.
+     * @param misses Number of lookups that found nothing.
+     * @param evictions Number of results removed to stay within the memory budget.
+     * @param entries Number of results currently stored.
+     * @param bytesUsed Bytes of keys and results currently stored.
+     * @param budgetBytes Memory budget in bytes; 0 when the cache is disabled.
+     */
+    struct Statistics {
+        std::size_t hits, misses, evictions, entries, bytesUsed, budgetBytes;
+
+        /**
+         * Gets the fraction of lookups that were hits
+         * @return double, hit rate (0 - 1), 0 when there were no lookups
+         */
+        double hitRate() const;
+    };
+
+    /**
+     * The process-wide cache consulted by SteamModeler::model. It is disabled until a budget is set.
+     * @return The process-wide cache.
+     */
+    static SteamModelerCache &instance();
+
+    /**
+     * Constructor for the cache
+     * @param budgetBytes Memory budget in bytes; 0 disables the cache.
+     */
+    explicit SteamModelerCache(std::size_t budgetBytes = 0);
+
+    /**
+     * Sets the memory budget, evicting the least recently used results that no longer fit.
+     * @param budgetBytes Memory budget in bytes; 0 disables and clears the cache.
+     */
+    void setBudget(std::size_t budgetBytes);
+
+    bool isEnabled() const;
+
+    /**
+     * Makes the cache key of a Steam Modeler input.
+     * @param input The Steam Modeler input data.
+     * @return The canonicalized, serialized input.
+     */
+    std::string makeKey(const SteamModelerInput &input) const;
+
+    /**
+     * Looks up a stored result and marks it as most recently used.
+     * @param key The cache key, see makeKey.
+     * @return A copy of the stored result, nullptr when not found.
+     */
+    std::shared_ptr<SteamModelerOutput> find(const std::string &key);
+
+    /**
+     * Stores a result as the most recently used one. Results larger than the budget are not stored.
+     * @param key The cache key, see makeKey.
+     * @param output The Steam Modeler processing results for that key.
+     */
+    void store(const std::string &key, const SteamModelerOutput &output);
+
+    /// Removes all results; the counters are kept.
+    void clear();
+
+    Statistics getStatistics() const;
+
+private:
+    struct Entry {
+        std::string output;
+        std::list<const std::string *>::iterator recency;
+    };
+
+    void evictToBudget();
+
+    const SteamModelerSerializer serializer = SteamModelerSerializer();
+
+    mutable std::mutex mutex;
+    /** Keys ordered from most to least recently used, pointing at the keys of entries so each key is stored once. */
+    std::list<const std::string *> recency;
+    std::unordered_map<std::string, Entry> entries;
+    std::size_t budgetBytes, bytesUsed = 0;
+    std::size_t hits = 0, misses = 0, evictions = 0;
+};
+
+#endif //AMO_TOOLS_SUITE_STEAMMODELERCACHE_H
@@ -0,0 +1,95 @@
+#ifndef AMO_TOOLS_SUITE_STEAMMODELERSERIALIZER_H
+#define AMO_TOOLS_SUITE_STEAMMODELERSERIALIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "SteamModelerInput.h"
+#include "SteamModelerOutput.h"
+
+/**
+ * Compact, versioned binary serialization of the Steam Modeler input and output.
+ *
+ * The format is a 12 byte header (magic "AMOS", format version, payload kind, byte order mark) followed by a flat
+ * sequence of fixed size fields: doubles and 32 bit enum values in host byte order, bools as single bytes and a
+ * presence byte in front of every optional (shared_ptr) member. Calculated objects (Boiler, Turbine, HeatLoss, ...)
+ * are restored field by field, so reading an output never recalculates any steam properties.
+ *
+ * Intended for caching solved scenarios on disk and passing results between processes on the same platform;
+ * data written with a different version or byte order is rejected.
+ */
+class SteamModelerSerializer {
+public:
+    /// Format version; increment whenever the layout of any serialized type changes.
+    static const std::uint32_t VERSION;
+
+    /**
+     * Serializes the Steam Modeler input.
+     * @param input The Steam Modeler input data.
+     * @return The binary representation.
+     */
+    std::string serialize(const SteamModelerInput &input) const;
+
+    /**
+     * Serializes the Steam Modeler output, including all of the calculations domains.
+     * @param output The Steam Modeler processing results.
+     * @return The binary representation.
+     */
+    std::string serialize(const SteamModelerOutput &output) const;
+
+    /**
+     * Restores the Steam Modeler input from its binary representation.
+     * @param data Start of the serialized data, e.g. a memory mapped file.
+     * @param size Size of the serialized data in bytes.
+     * @return The Steam Modeler input data.
+     * @throws std::runtime_error when the data is truncated, of another version or not a serialized input.
+     */
+    SteamModelerInput deserializeInput(const char *data, std::size_t size) const;
+
+    SteamModelerInput deserializeInput(const std::string &data) const;
+
+    /**
+     * Restores the Steam Modeler output from its binary representation.
+     * @param data Start of the serialized data, e.g. a memory mapped file.
+     * @param size Size of the serialized data in bytes.
+     * @return The Steam Modeler processing results.
+     * @throws std::runtime_error when the data is truncated, of another version or not a serialized output.
+     */
+    SteamModelerOutput deserializeOutput(const char *data, std::size_t size) const;
+
+    SteamModelerOutput deserializeOutput(const std::string &data) const;
+
+private:
+    class Writer;
+    class Reader;
+
+    void write(Writer &writer, const Boiler &boiler) const;
+    void write(Writer &writer, const std::shared_ptr<FlashTank> &flashTank) const;
+    void write(Writer &writer, const std::shared_ptr<PrvWithoutDesuperheating> &prv) const;
+    void write(Writer &writer, const std::shared_ptr<Turbine> &turbine) const;
+    void write(Writer &writer, const Deaerator &deaerator) const;
+    void write(Writer &writer, const HeatLoss &heatLoss) const;
+    void write(Writer &writer, const HighPressureHeaderCalculationsDomain &domain) const;
+    void write(Writer &writer, const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &domain) const;
+    void write(Writer &writer, const std::shared_ptr<LowPressureHeaderCalculationsDomain> &domain) const;
+    void write(Writer &writer, const MakeupWaterAndCondensateHeaderCalculationsDomain &domain) const;
+    void write(Writer &writer, const PowerBalanceCheckerCalculationsDomain &domain) const;
+    void write(Writer &writer, const ProcessSteamUsageCalculationsDomain &domain) const;
+    void write(Writer &writer, const EnergyAndCostCalculationsDomain &domain) const;
+
+    Boiler readBoiler(Reader &reader) const;
+    std::shared_ptr<FlashTank> readFlashTank(Reader &reader) const;
+    std::shared_ptr<PrvWithoutDesuperheating> readPrv(Reader &reader) const;
+    std::shared_ptr<Turbine> readTurbine(Reader &reader) const;
+    Deaerator readDeaerator(Reader &reader) const;
+    HeatLoss readHeatLoss(Reader &reader) const;
+    HighPressureHeaderCalculationsDomain readHighPressureHeader(Reader &reader) const;
+    std::shared_ptr<MediumPressureHeaderCalculationsDomain> readMediumPressureHeader(Reader &reader) const;
+    std::shared_ptr<LowPressureHeaderCalculationsDomain> readLowPressureHeader(Reader &reader) const;
+    MakeupWaterAndCondensateHeaderCalculationsDomain readMakeupWaterAndCondensateHeader(Reader &reader) const;
+    PowerBalanceCheckerCalculationsDomain readPowerBalanceChecker(Reader &reader) const;
+    ProcessSteamUsageCalculationsDomain readProcessSteamUsage(Reader &reader) const;
+    EnergyAndCostCalculationsDomain readEnergyAndCost(Reader &reader) const;
+};
+
+#endif //AMO_TOOLS_SUITE_STEAMMODELERSERIALIZER_H
@@ -8,10 +8,19 @@
 
 class DeaeratorFactory {
 public:
+    /**
+     * @param saturatedProperties Saturated properties at the deaerator pressure, see makeSaturatedProperties.
+     */
     const Deaerator make(const BoilerInput &boilerInput, const double feedwaterMassFlow,
+                         const SteamSystemModelerTool::SaturatedPropertiesOutput &saturatedProperties,
                          const SteamSystemModelerTool::FluidProperties &makeupWaterAndCondensateHeaderOutput,
                          const SteamSystemModelerTool::FluidProperties &inletHeaderOutput) const;
 
+    /**
+     * Saturated properties at the deaerator pressure; they depend on the boiler input only, so a steam model run
+     * makes them once for all its iterations.
+     */
+    SteamSystemModelerTool::SaturatedPropertiesOutput makeSaturatedProperties(const BoilerInput &boilerInput) const;
 };
 
 #endif //AMO_TOOLS_SUITE_DEAERATORFACTORY_H
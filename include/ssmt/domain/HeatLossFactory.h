@@ -1,20 +1,29 @@
 #ifndef AMO_TOOLS_SUITE_HEATLOSSFACTORY_H
 #define AMO_TOOLS_SUITE_HEATLOSSFACTORY_H
 
+#include <memory>
 #include <ssmt/api/HeaderInput.h>
 #include "ssmt/Header.h"
 #include "ssmt/HeatLoss.h"
 
+/**
+ * Makes the heat loss of a header. Given the heat loss of the same header on the previous steam model restart
+ * iteration, its steam properties are reused when the inlet state and percent heat loss are unchanged (see the
+ * HeatLoss fast path constructor).
+ */
 class HeatLossFactory {
 public:
     const HeatLoss make(const HeaderWithHighestPressure &highestPressureHeaderInput,
-                        const SteamSystemModelerTool::FluidProperties &headerOutput) const;
+                        const SteamSystemModelerTool::FluidProperties &headerOutput,
+                        const std::shared_ptr<HeatLoss> &previousHeatLoss = nullptr) const;
 
     const HeatLoss make(const std::shared_ptr<HeaderNotHighestPressure> &notHighestPressureHeaderInput,
-                        const SteamSystemModelerTool::FluidProperties &headerOutput) const;
+                        const SteamSystemModelerTool::FluidProperties &headerOutput,
+                        const std::shared_ptr<HeatLoss> &previousHeatLoss = nullptr) const;
 
     const HeatLoss
-    make(const SteamSystemModelerTool::FluidProperties &headerOutput, const double percentHeatLoss) const;
+    make(const SteamSystemModelerTool::FluidProperties &headerOutput, const double percentHeatLoss,
+         const std::shared_ptr<HeatLoss> &previousHeatLoss = nullptr) const;
 };
 
 #endif //AMO_TOOLS_SUITE_HEATLOSSFACTORY_H
@@ -27,6 +27,11 @@ public:
 
     Inlet makeWithEnthalpy(const SteamSystemModelerTool::FluidProperties &properties) const;
 
+    /**
+     * Makes an inlet from already calculated properties without evaluating the steam properties again.
+     */
+    Inlet makeWithProperties(const SteamSystemModelerTool::FluidProperties &properties) const;
+
     Inlet makeWithTemperature(const std::shared_ptr<HeatExchanger::Output> &output) const;
 };
 
@@ -0,0 +1,25 @@
+#ifndef AMO_TOOLS_SUITE_STEAMMODELRUNDOMAIN_H
+#define AMO_TOOLS_SUITE_STEAMMODELRUNDOMAIN_H
+
+#include <memory>
+#include <ssmt/HeatLoss.h>
+#include <ssmt/SteamSystemModelerTool.h>
+
+/**
+ * States one SteamModelRunner::run shares between the restart iterations of the Steam Model. The run owns them, so
+ * the modelers and factories keep no state between calls.
+ */
+class SteamModelRunDomain {
+public:
+    /// makeup water at atmospheric pressure and the makeup water temperature, the same for every iteration
+    SteamSystemModelerTool::SteamPropertiesOutput makeupWater;
+    /// saturated properties at the deaerator pressure, the same for every iteration
+    SteamSystemModelerTool::SaturatedPropertiesOutput deaeratorSaturatedProperties;
+
+    /// header heat losses of the previous iteration, nullptr before the first; see the HeatLoss fast path constructor
+    std::shared_ptr<HeatLoss> highPressureHeaderHeatLoss;
+    std::shared_ptr<HeatLoss> mediumPressureHeaderHeatLoss;
+    std::shared_ptr<HeatLoss> lowPressureHeaderHeatLoss;
+};
+
+#endif //AMO_TOOLS_SUITE_STEAMMODELRUNDOMAIN_H
@@ -16,7 +16,8 @@ public:
           const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
           const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
           const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
-          const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain) const;
+          const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
+          const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const;
 
 private:
     DeaeratorFactory deaeratorFactory = DeaeratorFactory();
@@ -31,7 +32,8 @@ private:
                             const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
                             const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
                             const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
-                            const double feedwaterMassFlow) const;
+                            const double feedwaterMassFlow,
+                            const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const;
 };
 
 #endif //AMO_TOOLS_SUITE_DEAERATORMODELER_H
@@ -4,6 +4,7 @@
 #include <memory>
 #include <ssmt/Boiler.h>
 #include <ssmt/Turbine.h>
+#include <ssmt/service/SteamBalanceTrace.h>
 
 /**
  * Determines when to have the Steam Modeler move to the next iteration attempt for balancing the system.
@@ -13,7 +14,8 @@ public:
     void restartIfNotEnoughSteam(const std::shared_ptr<Turbine> &turbine, const double availableMassFlow,
                                  const Boiler &boiler) const;
 
-    void restartIfNotEnoughSteam(const double additionalSteamNeeded, const Boiler &boiler) const;
+    void restartIfNotEnoughSteam(const double additionalSteamNeeded, const Boiler &boiler,
+                                 const SteamReductionBranch reductionBranch = SteamReductionBranch::NOT_REDUCED) const;
 
 private:
     void logMessage(const std::string &message) const;
@@ -0,0 +1,24 @@
+#ifndef AMO_TOOLS_SUITE_STEAMBALANCECONVERGENCEEXCEPTION_H
+#define AMO_TOOLS_SUITE_STEAMBALANCECONVERGENCEEXCEPTION_H
+
+#include <stdexcept>
+#include <string>
+#include <ssmt/service/SteamBalanceTrace.h>
+
+/**
+ * Thrown when the Steam Model did not balance within the maximum number of restarts.
+ * Carries the convergence trace of every attempt made.
+ */
+class SteamBalanceConvergenceException : public std::logic_error {
+public:
+    SteamBalanceConvergenceException(const std::string &message, const SteamBalanceTrace &trace);
+
+    friend std::ostream &operator<<(std::ostream &stream, const SteamBalanceConvergenceException &e);
+
+    const SteamBalanceTrace &getTrace() const;
+
+private:
+    SteamBalanceTrace trace;
+};
+
+#endif //AMO_TOOLS_SUITE_STEAMBALANCECONVERGENCEEXCEPTION_H
@@ -3,6 +3,7 @@
 
 #include <exception>
 #include <iostream>
+#include <ssmt/service/SteamBalanceTrace.h>
 
 /**
  * Represents a situation in the calculations when incorrect amount of steam remains,
@@ -14,8 +15,10 @@ public:
     /**
      * @param additionalSteamNeeded The additional amount of steam needed.
      * @param adjustedInitialSteam The adjusted amount of steam to use when re-running the model.
+     * @param reductionBranch The steam reduction taken from the high to low turbine before restarting, if any.
      */
-    SteamBalanceException(double additionalSteamNeeded, double adjustedInitialSteam);
+    SteamBalanceException(double additionalSteamNeeded, double adjustedInitialSteam,
+                          SteamReductionBranch reductionBranch = SteamReductionBranch::NOT_REDUCED);
 
     friend std::ostream &operator<<(std::ostream &stream, const SteamBalanceException &e);
 
@@ -23,9 +26,12 @@ public:
 
     double getAdjustedInitialSteam() const;
 
+    SteamReductionBranch getReductionBranch() const;
+
 private:
     double additionalSteamNeeded;
     double adjustedInitialSteam;
+    SteamReductionBranch reductionBranch;
 };
 
 #endif //AMO_TOOLS_SUITE_STEAMBALANCEEXCEPTION_H
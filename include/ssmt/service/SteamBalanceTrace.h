@@ -0,0 +1,71 @@
+#ifndef AMO_TOOLS_SUITE_STEAMBALANCETRACE_H
+#define AMO_TOOLS_SUITE_STEAMBALANCETRACE_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * How the SteamReducer took steam from the high to low pressure turbine, see
+ * SteamReducer::reduceSteamThroughHighToLowTurbine.
+ */
+enum class SteamReductionBranch {
+    NOT_REDUCED,
+    BALANCE_HEADER,
+    POWER_RANGE,
+    FLOW_RANGE
+};
+
+/**
+ * One attempt of the SteamModelRunner at balancing the system.
+ */
+class SteamBalanceIteration {
+public:
+    int iteration;
+    /// Initial steam mass flow the attempt started with.
+    double initialMassFlow;
+    bool balanced;
+    /// Residual of the attempt, the additional steam the system still needed; 0 when balanced.
+    double additionalSteamNeeded;
+    /// Initial steam mass flow for the next attempt; 0 when balanced.
+    double adjustedInitialSteam;
+    /// Steam reduction taken just before the attempt was restarted.
+    SteamReductionBranch reductionBranch;
+
+    friend std::ostream &operator<<(std::ostream &stream, const SteamBalanceIteration &iteration);
+};
+
+/**
+ * Convergence trace of a SteamModelRunner::run, one entry per attempt at balancing the system.
+ */
+class SteamBalanceTrace {
+public:
+    const std::vector<SteamBalanceIteration> &getIterations() const;
+
+    std::size_t getIterationCount() const;
+
+    /**
+     * @return true when the last attempt balanced the system.
+     */
+    bool isBalanced() const;
+
+    void add(const SteamBalanceIteration &iteration);
+
+    void clear();
+
+    /**
+     * Exports the trace with a header row, one row per attempt: iteration, initialMassFlow, balanced,
+     * additionalSteamNeeded, adjustedInitialSteam, reductionBranch.
+     * @return The trace as comma separated values.
+     */
+    std::string toCsv() const;
+
+    friend std::ostream &operator<<(std::ostream &stream, const SteamBalanceTrace &trace);
+
+private:
+    std::vector<SteamBalanceIteration> iterations;
+};
+
+std::string toString(SteamReductionBranch reductionBranch);
+
+#endif //AMO_TOOLS_SUITE_STEAMBALANCETRACE_H
@@ -9,6 +9,7 @@
 #include <ssmt/domain/EnergyAndCostCalculationsDomain.h>
 #include <ssmt/domain/FlashTankFactory.h>
 #include <ssmt/domain/SteamModelCalculationsDomain.h>
+#include <ssmt/domain/SteamModelRunDomain.h>
 #include <ssmt/service/energy_and_cost/EnergyAndCostCalculator.h>
 #include <ssmt/service/high_pressure_header/HighPressureHeaderModeler.h>
 #include <ssmt/service/low_pressure_header/LowPressureHeaderModeler.h>
@@ -22,10 +23,14 @@
  */
 class SteamModelCalculator {
 public:
+    /**
+     * @param runDomain States shared by the iterations of the run; its header heat losses are updated with those of
+     * this iteration.
+     */
     SteamModelCalculationsDomain
     calc(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
          const BoilerInput &boilerInput, const TurbineInput &turbineInput, const OperationsInput &operationsInput,
-         const double initialMassFlow) const;
+         const double initialMassFlow, SteamModelRunDomain &runDomain) const;
 
 private:
     const BoilerFactory boilerFactory = BoilerFactory();
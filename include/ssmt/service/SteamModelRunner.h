@@ -5,9 +5,13 @@
 #include <ssmt/api/HeaderInput.h>
 #include <ssmt/api/OperationsInput.h>
 #include <ssmt/api/TurbineInput.h>
+#include <ssmt/domain/DeaeratorFactory.h>
 #include <ssmt/domain/SteamModelCalculationsDomain.h>
+#include <ssmt/service/SteamBalanceConvergenceException.h>
 #include <ssmt/service/SteamBalanceException.h>
+#include <ssmt/service/SteamBalanceTrace.h>
 #include <ssmt/service/SteamModelCalculator.h>
+#include <ssmt/service/water_and_condensate/MakeupWaterCalculator.h>
 
 /**
  * Runs the Steam Model.
@@ -23,18 +27,33 @@ public:
      * @param turbineInput All of the turbines input data.
      * @param operationsInput The operational input data.
      * @return The Steam Modeler processing results.
-     * @throws std::logic_error when unable to attain balanced steam model.
+     * @throws SteamBalanceConvergenceException (a std::logic_error) when unable to attain balanced steam model.
      */
     SteamModelCalculationsDomain
     run(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
         const BoilerInput &boilerInput, const TurbineInput &turbineInput, const OperationsInput &operationsInput) const;
 
+    /**
+     * Repeatedly run the Steam Model algorithm until the system balances, recording every attempt.
+     * @param trace Receives one entry per attempt: the initial steam used, the residual steam need, the adjusted
+     * initial steam for the next attempt and the steam reduction taken before restarting.
+     * @throws SteamBalanceConvergenceException (a std::logic_error) with the trace when unable to attain balanced
+     * steam model.
+     */
+    SteamModelCalculationsDomain
+    run(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
+        const BoilerInput &boilerInput, const TurbineInput &turbineInput, const OperationsInput &operationsInput,
+        SteamBalanceTrace &trace) const;
+
 private:
     const SteamModelCalculator steamModelCalculator = SteamModelCalculator();
     const MassFlowCalculator massFlowCalculator = MassFlowCalculator();
+    const MakeupWaterCalculator makeupWaterCalculator = MakeupWaterCalculator();
+    const DeaeratorFactory deaeratorFactory = DeaeratorFactory();
 
     double
-    handleSteamBalanceException(const SteamBalanceException &e, const int iterationCount, const double initialMassFlow) const;
+    handleSteamBalanceException(const SteamBalanceException &e, const int iterationCount, const double initialMassFlow,
+                                SteamBalanceTrace &trace) const;
 
     void logSection(const std::string &message) const;
 };
@@ -4,6 +4,7 @@
 #include <ssmt/Turbine.h>
 #include <ssmt/api/TurbineInput.h>
 #include <ssmt/domain/TurbineFactory.h>
+#include <ssmt/service/SteamBalanceTrace.h>
 
 //TODO extract class
 class SteamReducerOutput {
@@ -11,12 +12,14 @@ public:
     double remainingAdditionalSteamNeeded;
     std::shared_ptr<Turbine> highToLowPressureTurbineUpdated;
     std::shared_ptr<Turbine> highToLowPressureTurbineIdealUpdated;
+    SteamReductionBranch reductionBranch;
 
     friend std::ostream &operator<<(std::ostream &stream, const SteamReducerOutput &output) {
         stream << "Turbine["
                << "remainingAdditionalSteamNeeded=" << static_cast< int >(output.remainingAdditionalSteamNeeded)
                << ", highToLowPressureTurbineUpdated=" << output.highToLowPressureTurbineUpdated
                << ", highToLowPressureTurbineIdealUpdated=" << output.highToLowPressureTurbineIdealUpdated
+               << ", reductionBranch=" << toString(output.reductionBranch)
                << "]";
         return stream;
     }
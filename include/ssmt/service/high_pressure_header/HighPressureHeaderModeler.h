@@ -23,7 +23,8 @@ public:
           const std::shared_ptr<HeaderNotHighestPressure> &mediumPressureHeaderInput,
           const std::shared_ptr<HeaderNotHighestPressure> &lowPressureHeaderInput,
           const PressureTurbine &highToMediumTurbineInput, const PressureTurbine &highToLowTurbineInput,
-          const CondensingTurbine &condensingTurbineInput, const Boiler &boiler) const;
+          const CondensingTurbine &condensingTurbineInput, const Boiler &boiler,
+          const std::shared_ptr<HeatLoss> &previousHeatLoss = nullptr) const;
 
     HighToMediumSteamTurbineCalculationsDomain
     calcHighToMediumSteamTurbine(const int headerCountInput, const HeaderWithHighestPressure &highPressureHeaderInput,
@@ -31,7 +31,8 @@ public:
           const CondensingTurbine &condensingTurbineInput, const BoilerInput &boilerInput, const Boiler &boiler,
           const std::shared_ptr<FlashTank> &blowdownFlashTank,
           const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
-          const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain) const;
+          const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
+          const std::shared_ptr<HeatLoss> &previousHeatLoss = nullptr) const;
 
 private:
     const FlashTankFactory flashTankFactory = FlashTankFactory();
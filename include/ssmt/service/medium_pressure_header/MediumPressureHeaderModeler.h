@@ -24,7 +24,8 @@ public:
           const std::shared_ptr<HeaderNotHighestPressure> &lowPressureHeaderInput,
           const PressureTurbine &highToMediumTurbineInput, const PressureTurbine &highToLowTurbineInput,
           const PressureTurbine &mediumToLowTurbineInput, const CondensingTurbine &condensingTurbineInput,
-          const Boiler &boiler, HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain) const;
+          const Boiler &boiler, HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
+          const std::shared_ptr<HeatLoss> &previousHeatLoss = nullptr) const;
 
 private:
     const FluidPropertiesFactory fluidPropertiesFactory = FluidPropertiesFactory();
@@ -43,7 +44,8 @@ private:
                    const PressureTurbine &highToMediumTurbineInput, const PressureTurbine &highToLowTurbineInput,
                    const PressureTurbine &mediumToLowTurbineInput, const CondensingTurbine &condensingTurbineInput,
                    const Boiler &boiler,
-                   const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain) const;
+                   const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
+                   const std::shared_ptr<HeatLoss> &previousHeatLoss) const;
 };
 
 #endif //AMO_TOOLS_SUITE_MEDIUMPRESSUREHEADERMODELER_H
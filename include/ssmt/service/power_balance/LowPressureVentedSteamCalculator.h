@@ -29,7 +29,8 @@ public:
              const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
              const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
              MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
-             const double deaeratorInletSteamMassFlow, const bool recalcMakeupWaterAndMassFlow) const;
+             const double deaeratorInletSteamMassFlow, const bool recalcMakeupWaterAndMassFlow,
+             const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const;
 
 private:
     const DeaeratorModeler deaeratorModeler = DeaeratorModeler();
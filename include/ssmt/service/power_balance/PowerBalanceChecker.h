@@ -32,7 +32,8 @@ public:
           const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
           const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
           const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
-          MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain) const;
+          MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
+          const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const;
 
 private:
     const FluidPropertiesFactory fluidPropertiesFactory = FluidPropertiesFactory();
@@ -28,12 +28,6 @@ private:
                      const std::shared_ptr<HeatExchanger::Output> &heatExchangerOutput,
                      const SteamSystemModelerTool::FluidProperties &makeupWaterAndMassFlow,
                      const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain) const;
-
-    SteamSystemModelerTool::SteamPropertiesOutput
-    calcSteamProperties(const SteamSystemModelerTool::FluidProperties &fluidProperties) const;
-
-    void updateHeaderWithSteam(SteamSystemModelerTool::FluidProperties &headerResult,
-                               const SteamSystemModelerTool::SteamPropertiesOutput &steamPropertiesOutput) const;
 };
 
 #endif //AMO_TOOLS_SUITE_MAKEUPWATERANDCONDENSATEHEADERCALCULATOR_H
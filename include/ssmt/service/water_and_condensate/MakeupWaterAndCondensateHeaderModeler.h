@@ -2,7 +2,6 @@
 #define AMO_TOOLS_SUITE_WATERANDCONDENSATEMODELER_H
 
 #include "CombinedCondensateCalculator.h"
-#include "MakeupWaterCalculator.h"
 #include "MakeupWaterMassFlowCalculator.h"
 #include "ReturnCondensateCalculator.h"
 #include "HeatExchangerCalculator.h"
@@ -30,7 +29,8 @@ public:
               const std::shared_ptr<FlashTank> &blowdownFlashTank,
               const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
               const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
-              const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain) const;
+              const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
+              const SteamSystemModelerTool::SteamPropertiesOutput &makeupWaterOnly) const;
 
 private:
     CombinedCondensateCalculator combinedCondensateCalculator = CombinedCondensateCalculator();
@@ -38,7 +38,6 @@ private:
     FluidPropertiesFactory fluidPropertiesFactory = FluidPropertiesFactory();
     HeaderFactory headerFactory = HeaderFactory();
     HeatExchangerCalculator heatExchangerCalculator = HeatExchangerCalculator();
-    MakeupWaterCalculator makeupWaterCalculator = MakeupWaterCalculator();
     MakeupWaterAndCondensateHeaderCalculator makeupWaterAndCondensateHeaderCalculator = MakeupWaterAndCondensateHeaderCalculator();
     MakeupWaterMassFlowCalculator makeupWaterMassFlowCalculator = MakeupWaterMassFlowCalculator();
     MakeupWaterVolumeFlowCalculator makeupWaterVolumeFlowCalculator = MakeupWaterVolumeFlowCalculator();
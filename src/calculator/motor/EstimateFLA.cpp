@@ -15,7 +15,114 @@
 #include "calculator/motor/EstimateFLA.h"
 #include "calculator/motor/MotorEfficiency.h"
 #include "calculator/motor/Poles.h"
-#include <fstream>
+
+namespace {
+    /**
+     * FLA coefficients of one pole count. The basic FLA and the EE and SE multipliers are c0 + c1 exp(-c2 P) +
+     * c3 exp(-c4 P) of the rated power P; the part load coefficients, 2004, give the multipliers at 0% to 125% load
+     * the same way, column by column.
+     */
+    struct PoleCoefficients {
+        double flaBasic[5], eeFlaMultiplier[5], seFlaMultiplier[5];
+        double partialLoad[5][6];
+    };
+
+    /// by pole index, 2 poles to 12 poles
+    const PoleCoefficients poleCoefficients[6] = {
+            // 2 poles
+            {{1.07000005, 0.04457, 0.00075042, 0.1177211, 0.0328443},
+             {0.99800003, -0.00686105, 0.00086324, -0.02477271, 0.07267418},
+             {1.00199997, 0.0305805, 0.00538086, 0.02411943, 0.03430828},
+             {
+                     {0.2385152, 0.31999999, 0.51999998, 0.75400001, 1, 1.253},
+                     {0.04319932, 0.03559835, 0.02311537, 0.00837315, 0, 0},
+                     {0.01191111, 0.00243387, 0.00018377, 0.00013998, 0, 0},
+                     {0.176818, 0.1282783, 0.08376596, 0.03318606, 0, 0},
+                     {0.1847319, 0.1831789, 0.16219489, 0.1855139, 0, 0}
+             }},
+            // 4 poles
+            {{1.07860196, 0.06776789, 0.00112793, 0.1706723, 0.03456966},
+             {0.99959999, -0.00768858, 0.00471104, -0.01760195, 0.04482816},
+             {1.00150001, 0.02305459, 0.00630689, 0.02706193, 0.01757208},
+             {
+                     {0.26803651, 0.3535319, 0.54000002, 0.76428652, 1, 1.251},
+                     {0.08, 0.06387088, 0.02691548, 0.0081415, 0, 0},
+                     {0.01172604, 0.01068725, 0.00297117, 0.00686711, 0, 0},
+                     {0.2029126, 0.1705882, 0.09793611, 0.0471422, 0, 0},
+                     {0.15413959, 0.1315202, 0.09374535, 0.1191377, 0, 0}
+             }},
+            // 6 poles
+            {{1.11131799, 0.1038059, 0.00208467, 0.3346993, 0.1037901},
+             {0.99800003, -0.01313299, 0.01482941, -0.2489823, 0.63720071},
+             {1.00399995, 0.06148619, 0.01415263, 1.247298, 0.72734421},
+             {
+                     {0.28999999, 0.39519981, 0.55500001, 0.76973772, 1, 1.254},
+                     {0.07532283, 0.06387088, 0.03, 0.02362101, 0, 0},
+                     {0.00291026, 0.01068725, 0.00380051, 0.08841167, 0, 0},
+                     {0.2405144, 0.1705882, 0.13686571, 0.02321446, 0, 0},
+                     {0.09842682, 0.1315202, 0.15484551, 0.08854395, 0, 0}
+             }},
+            // 8 poles
+            {{1.20000005, 0.09800907, 0.00239285, 0.44619089, 0.07508431},
+             {0.995, -0.02334039, 0.05637734, -0.79541528, 0.59844083},
+             {1.005, 0.04535436, 0.01991553, 24.98793983, 1.14514899},
+             {
+                     {0.33000001, 0.43000001, 0.56062472, 0.78429687, 1, 1.237},
+                     {0.06, 0.1060414, 0.04872012, 0.00763685, 0, 0},
+                     {0.00125301, 0.031788, 0.00041673, 0.0023581, 0, 0},
+                     {0.1939563, 0.115, 0.0841061, 0.00756603, 0, 0},
+                     {0.05575958, 0.15824869, 0.05538078, 0.00250876, 0, 0}
+             }},
+            // 10 poles
+            {{1.25399995, 0.10241948, 0.00239285, 0.46626949, 0.07508431},
+             {0.995, -0.02334039, 0.05637734, -0.79541528, 0.59844083},
+             {1.005, 0.04535436, 0.01991553, 24.98793983, 1.14514899},
+             {
+                     {0.37, 0.44, 0.57857579, 0.78581947, 1, 1.233},
+                     {0.04507853, 0.04205693, 0.06270286, 0.01749944, 0, 0},
+                     {0.00098519, 0.00121622, 0.0005819, 0.00068763, 0, 0},
+                     {0.20683549, 0.1764105, 0.08895831, 0.01809594, 0, 0},
+                     {0.0551472, 0.05516704, 0.05197735, 0.03981217, 0, 0}
+             }},
+            // 12 poles
+            {{1.296, 0.1058498, 0.00239285, 0.48188618, 0.07508431},
+             {0.995, -0.02334039, 0.05637734, -0.79541528, 0.59844083},
+             {1.005, 0.04535436, 0.01991553, 24.98793983, 1.14514899},
+             {
+                     {0.41999999, 0.5, 0.61000001, 0.80000001, 1, 1.215},
+                     {0.04507853, 0.04205693, 0.06270286, 0.01749944, 0, 0},
+                     {0.00098519, 0.00121622, 0.0005819, 0.00068763, 0, 0},
+                     {0.20683549, 0.1764105, 0.08895831, 0.01809594, 0, 0},
+                     {0.0551472, 0.05516704, 0.05197735, 0.03981217, 0, 0}
+             }}
+    };
+
+    /// PE multipliers are given up to 6 poles; motors with more poles use those of 6 poles
+    const double peFlaMultipliers[3][5] = {
+            {0.972803032, 2.132557437, 0.013323999, -2.145127031, 0.013678436},
+            {0.988822468, 0.385982899, 0.410275377, -0.045828557, 0.057848012},
+            {0.990453682, -0.775656291, 0.078563841, 0.735405576, 0.071461107}
+    };
+
+    inline double multiplier(const double (&c)[5], const double motorRatedPower) {
+        return c[0] + (c[1] * std::exp(-c[2] * motorRatedPower)) + (c[3] * std::exp(-c[4] * motorRatedPower));
+    }
+}
+
+std::array<double, 6> EstimateFLA::calculate() {
+    return partLoadCurrents;
+}
+
+std::vector<double> EstimateFLA::calculate(const std::vector<Motor> &motors) {
+    std::vector<double> estimatedFLAs;
+    estimatedFLAs.reserve(motors.size());
+    for (auto const & motor : motors) {
+        estimatedFLAs.push_back(EstimateFLA(motor.motorRatedPower, motor.motorRpm, motor.lineFrequency,
+                                            motor.efficiencyClass, motor.specifiedEfficiency,
+                                            motor.motorRatedVoltage).getEstimatedFLA());
+    }
+    return estimatedFLAs;
+}
 
 /**
  * Estimating FLA methodology
@@ -47,178 +154,54 @@
  * Estimated FLA (575) = Estimated FLA (460) * (460/575)
  * Estimated FLA (575)=	181.8
  *
- * @return std::array<double, 6>, 25% interval values of current.
+ * Sets the 25% interval values of current returned by calculate() and the estimated FLA.
  */
-
-const std::array<std::array<double, 6>, 5> EstimateFLA::calculatePartialLoadCoefficients(const int pole) const {
-    if (pole == 0) {
-        return {
-                {
-                        {{0.2385152,  0.31999999, 0.51999998, 0.75400001, 1, 1.253}},
-                        {{0.04319932, 0.03559835, 0.02311537, 0.00837315, 0, 0}},
-                        {{0.01191111, 0.00243387, 0.00018377, 0.00013998, 0, 0}},
-                        {{0.176818,   0.1282783,  0.08376596, 0.03318606, 0, 0}},
-                        {{0.1847319,  0.1831789,  0.16219489, 0.1855139,  0, 0}}
-                }
-        };
-    } else if (pole == 1) {
-        return {
-                {
-                        {{0.26803651, 0.3535319,  0.54000002, 0.76428652, 1, 1.251}},
-                        {{0.08,       0.06387088, 0.02691548, 0.0081415,  0, 0}},
-                        {{0.01172604, 0.01068725, 0.00297117, 0.00686711, 0, 0}},
-                        {{0.2029126,  0.1705882,  0.09793611, 0.0471422,  0, 0}},
-                        {{0.15413959, 0.1315202,  0.09374535, 0.1191377,  0, 0}}
-                }
-        };
-    } else if (pole == 2) {
-        return {
-                {
-                        {{0.28999999, 0.39519981, 0.55500001, 0.76973772, 1, 1.254}},
-                        {{0.07532283, 0.06387088, 0.03,       0.02362101, 0, 0}},
-                        {{0.00291026, 0.01068725, 0.00380051, 0.08841167, 0, 0}},
-                        {{0.2405144,  0.1705882,  0.13686571, 0.02321446, 0, 0}},
-                        {{0.09842682, 0.1315202,  0.15484551, 0.08854395, 0, 0}}
-                }
-        };
-    } else if (pole == 3) {
-        return {
-                {
-                        {{0.33000001, 0.43000001, 0.56062472, 0.78429687, 1, 1.237}},
-                        {{0.06,       0.1060414,  0.04872012, 0.00763685, 0, 0}},
-                        {{0.00125301, 0.031788,   0.00041673, 0.0023581,  0, 0}},
-                        {{0.1939563,  0.115,      0.0841061,  0.00756603, 0, 0}},
-                        {{0.05575958, 0.15824869, 0.05538078, 0.00250876, 0, 0}}
-                }
-        };
-    } else if (pole == 4) {
-        return {
-                {
-                        {{0.37,       0.44,       0.57857579, 0.78581947, 1, 1.233}},
-                        {{0.04507853, 0.04205693, 0.06270286, 0.01749944, 0, 0}},
-                        {{0.00098519, 0.00121622, 0.0005819,  0.00068763, 0, 0}},
-                        {{0.20683549, 0.1764105,  0.08895831, 0.01809594, 0, 0}},
-                        {{0.0551472,  0.05516704, 0.05197735, 0.03981217, 0, 0}}
-                }
-        };
-    }
-    // pole == 5 here
-    return {
-            {
-                    {{0.41999999, 0.5,        0.61000001, 0.80000001, 1, 1.215}},
-                    {{0.04507853, 0.04205693, 0.06270286, 0.01749944, 0, 0}},
-                    {{0.00098519, 0.00121622, 0.0005819,  0.00068763, 0, 0}},
-                    {{0.20683549, 0.1764105,  0.08895831, 0.01809594, 0, 0}},
-                    {{0.0551472,  0.05516704, 0.05197735, 0.03981217, 0, 0}}
-            }
-    };
-}
-
-std::array<double, 6> EstimateFLA::calculate() {
+void EstimateFLA::estimate() {
     /**
      * Calculate the number of poles based on the RPM and use it as an index
      */
     int const pole = (Poles(motorRPM, lineFrequency).calculate() / 2) - 1;
+    PoleCoefficients const & coefficients = poleCoefficients[pole];
 
     /**
-     * Calculate basic FLA value
-     */
-    double const basicFLAValue = motorRatedPower
-                                 * (flaBasic[0][pole] + (flaBasic[1][pole] * std::exp(-flaBasic[2][pole] * motorRatedPower))
-                                    + (flaBasic[3][pole] * std::exp(-flaBasic[4][pole] * motorRatedPower)));
-    /**
-     * Calculate EE multiplier
-     */
-    double const eeMultiplier = eeFlaMultipliers[0][pole]
-                                + (eeFlaMultipliers[1][pole] * std::exp(-eeFlaMultipliers[2][pole] * motorRatedPower))
-                                + (eeFlaMultipliers[3][pole] * std::exp(-eeFlaMultipliers[4][pole] * motorRatedPower));
-    /**
-     * Calculate SE multiplier
+     * Calculate basic FLA value, EE and SE values
      */
-    double const seMultiplier = seFlaMultipliers[0][pole]
-                                + (seFlaMultipliers[1][pole] * std::exp(-seFlaMultipliers[2][pole] * motorRatedPower))
-                                + (seFlaMultipliers[3][pole] * std::exp(-seFlaMultipliers[4][pole] * motorRatedPower));
-    
+    double const basicFLAValue = motorRatedPower * multiplier(coefficients.flaBasic, motorRatedPower);
+    double const eeFLAValue = multiplier(coefficients.eeFlaMultiplier, motorRatedPower) * basicFLAValue;
+    double const seFLAValue = multiplier(coefficients.seFlaMultiplier, motorRatedPower) * basicFLAValue;
+
     /**
-     * Calculate EE or SE values
+     * Multipliers for partial loads in 25% intervals
      */
-    double const eeFLAValue = eeMultiplier * basicFLAValue;
-    double const seFLAValue = seMultiplier * basicFLAValue;
-
-	/*
-	 * Part load coefficients, 2004
-     * Select partial load multipliers based on pole.
-	 */
-    const std::array<std::array<double, 6>, 5> partialLoadCoefficients = calculatePartialLoadCoefficients(pole);
-
-	/**
-	 * Calculating Multiplier for partial loads in 25% intervals via lambda function
-	 */
-    auto const plMult = [&partialLoadCoefficients, this] (std::size_t i) {
-        return partialLoadCoefficients[0][i] + (partialLoadCoefficients[1][i] * std::exp(-1 * partialLoadCoefficients[2][i] * motorRatedPower))
-               + (partialLoadCoefficients[3][i] * std::exp(-1 * partialLoadCoefficients[4][i] * motorRatedPower));
-    };
-
-    const std::array<double, 6> plMultiplier = {
-            {
-                    plMult(0), plMult(1), plMult(2), plMult(3), plMult(4), plMult(5)
-            }
-    };
+    std::array<double, 6> plMultiplier;
+    for (std::size_t i = 0; i < plMultiplier.size(); ++i) {
+        plMultiplier[i] = coefficients.partialLoad[0][i]
+                          + (coefficients.partialLoad[1][i] * std::exp(-coefficients.partialLoad[2][i] * motorRatedPower))
+                          + (coefficients.partialLoad[3][i] * std::exp(-coefficients.partialLoad[4][i] * motorRatedPower));
+    }
 
     // used to calculate FLA
-    auto const adjustForVoltage = [this] (double plVal, double effVal = 0) {
+    auto const adjustForVoltage = [this] (double plVal, double effVal) {
         auto const estimate = plVal * 460 / ratedVoltage;
         if (efficiencyClass == Motor::EfficiencyClass::SPECIFIED) {
             return effVal * estimate * 100 / specifiedEfficiency;
         }
         return estimate;
     };
+    auto const setValues = [this, &plMultiplier, &adjustForVoltage] (double flaValue, double effVal) {
+        for (std::size_t i = 0; i < partLoadCurrents.size(); ++i) {
+            partLoadCurrents[i] = flaValue * plMultiplier[i];
+        }
+        estimatedFLA = adjustForVoltage(flaValue * plMultiplier[4], effVal);
+    };
 
     if (efficiencyClass == Motor::EfficiencyClass::PREMIUM) {
-        double const peMultiplier = peFlaMultipliers[0][pole]
-                                    + (peFlaMultipliers[1][pole] * std::exp(-peFlaMultipliers[2][pole] * motorRatedPower))
-                                    + (peFlaMultipliers[3][pole] * std::exp(-peFlaMultipliers[4][pole] * motorRatedPower));
-
-        double const peFLAValue = peMultiplier * basicFLAValue;
-        estimatedFLA = adjustForVoltage(peFLAValue * plMultiplier[4]);
-        return {
-                {
-                        peFLAValue * plMultiplier[0], peFLAValue * plMultiplier[1], peFLAValue * plMultiplier[2],
-                        peFLAValue * plMultiplier[3], peFLAValue * plMultiplier[4], peFLAValue * plMultiplier[5]
-                }
-        };
-        
-//        auto motorEfficiency = MotorEfficiency(lineFrequency, motorRPM, Motor::EfficiencyClass::ENERGY_EFFICIENT, motorRatedPower);
-//        const double effValEE = motorEfficiency.calculate(1);
-//        motorEfficiency.setEfficiencyClass(Motor::EfficiencyClass::PREMIUM);
-//        const double effValPE = motorEfficiency.calculate(1);
-//        const double val = eeFLAValue * effValPE / effValEE;
-//	    estimatedFLA = adjustForVoltage(val * plMultiplier[4]);
-//        return {
-//                {
-//                        val * plMultiplier[0], val * plMultiplier[1], val * plMultiplier[2],
-//                        val * plMultiplier[3], val * plMultiplier[4], val * plMultiplier[5]
-//                }
-//        };
-    }
-
-
-    if (efficiencyClass == Motor::EfficiencyClass::ENERGY_EFFICIENT) {
-        estimatedFLA = adjustForVoltage(eeFLAValue * plMultiplier[4]);
-        return {
-                {
-                        eeFLAValue * plMultiplier[0], eeFLAValue * plMultiplier[1], eeFLAValue * plMultiplier[2],
-                        eeFLAValue * plMultiplier[3], eeFLAValue * plMultiplier[4], eeFLAValue * plMultiplier[5]
-                }
-        };
+        double const peMultiplier = multiplier(peFlaMultipliers[pole < 3 ? pole : 2], motorRatedPower);
+        setValues(peMultiplier * basicFLAValue, 0);
+    } else if (efficiencyClass == Motor::EfficiencyClass::ENERGY_EFFICIENT) {
+        setValues(eeFLAValue, 0);
     } else if (efficiencyClass == Motor::EfficiencyClass::STANDARD) {
-        estimatedFLA = adjustForVoltage(seFLAValue * plMultiplier[4]);
-        return {
-                {
-                        seFLAValue * plMultiplier[0], seFLAValue * plMultiplier[1], seFLAValue * plMultiplier[2],
-                        seFLAValue * plMultiplier[3], seFLAValue * plMultiplier[4], seFLAValue * plMultiplier[5]
-                }
-        };
+        setValues(seFLAValue, 0);
     } else if (efficiencyClass == Motor::EfficiencyClass::SPECIFIED) {
         /**
          * For a case where the efficiency has been specified, there is a multiple step process:
@@ -226,35 +209,17 @@ std::array<double, 6> EstimateFLA::calculate() {
          * 2. Pick the smaller of the two absolute values, and use the nominal efficiency of that selection going forward
          * 3. Divide the selected (EE or SE) efficiency by the specified efficiency and then multiply that by the FLA for the corresponding selection.
          */
-
         auto const seeffVal = MotorEfficiency(lineFrequency, motorRPM, Motor::EfficiencyClass::STANDARD,
-                                            motorRatedPower).calculate(1, specifiedEfficiency);
-   
+                                              motorRatedPower).calculate(1, specifiedEfficiency);
         auto const eeeffVal = MotorEfficiency(lineFrequency, motorRPM, Motor::EfficiencyClass::ENERGY_EFFICIENT,
-                                            motorRatedPower).calculate(1, specifiedEfficiency);
+                                              motorRatedPower).calculate(1, specifiedEfficiency);
 
-        if (std::fabs(seeffVal - (specifiedEfficiency / 100)) < std::fabs(eeeffVal - (specifiedEfficiency / 100)))
-        {
-                // SE is the nominal efficiency
-             estimatedFLA = adjustForVoltage(seFLAValue * plMultiplier[4], seeffVal);
-                return {
-                        {
-                                seFLAValue * plMultiplier[0], seFLAValue * plMultiplier[1], seFLAValue * plMultiplier[2],
-                                seFLAValue * plMultiplier[3], seFLAValue * plMultiplier[4], seFLAValue * plMultiplier[5]
-                        }
-                };
-        }
-        else 
-        {
-                /// EE is the nominal efficiency
-             estimatedFLA = adjustForVoltage(eeFLAValue * plMultiplier[4], eeeffVal);
-                return {
-                        {
-                                eeFLAValue * plMultiplier[0], eeFLAValue * plMultiplier[1], eeFLAValue * plMultiplier[2],
-                                eeFLAValue * plMultiplier[3], eeFLAValue * plMultiplier[4], eeFLAValue * plMultiplier[5]
-                        }
-                };
+        if (std::fabs(seeffVal - (specifiedEfficiency / 100)) < std::fabs(eeeffVal - (specifiedEfficiency / 100))) {
+            // SE is the nominal efficiency
+            setValues(seFLAValue, seeffVal);
+        } else {
+            /// EE is the nominal efficiency
+            setValues(eeFLAValue, eeeffVal);
         }
     }
-    return {};
 }
@@ -28,6 +28,20 @@
  * @return motor current
  */
 double MotorCurrent::calculateCurrent(const double fullLoadAmps) {
+    std::array<double, 6> const plValues = calculatePartLoadCurrents(fullLoadAmps);
+
+    if (loadFactor < 0.251) {
+        return CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::ZERO_TO_HALF_LOAD, &plValues[0], loadFactor);
+    } else if (loadFactor < 1.251) {
+        return CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, &plValues[1], loadFactor);
+    }
+    if (loadFactor > 1.5) {
+        loadFactor = 1.5;
+    }
+    return CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, &plValues[3], loadFactor);
+}
+
+std::array<double, 6> MotorCurrent::calculatePartLoadCurrents(const double fullLoadAmps) {
     EstimateFLA estimateFLA(motorRatedPower, motorRPM, lineFrequency, efficiencyClass, specifiedEfficiency,
                             ratedVoltage);
     std::array<double, 6> plValues = estimateFLA.calculate();
@@ -42,18 +56,7 @@ double MotorCurrent::calculateCurrent(const double fullLoadAmps) {
     for (auto & val : plValues) {
         val *= fullLoadAmps / tempFLA;
     }
-
-
-    if (loadFactor < 0.251) {
-        return CurveFitVal({0, 0.25, 0.5}, {plValues[0], plValues[1], plValues[2]}, 2, loadFactor).calculate();
-    } else if (loadFactor < 1.251) {
-        CurveFitVal cfv({0.25, 0.5, 0.75, 1, 1.25}, {plValues[1], plValues[2], plValues[3], plValues[4], plValues[5]}, 4, loadFactor);
-        return cfv.calculate();
-    }
-    if (loadFactor > 1.5) {
-        loadFactor = 1.5;
-    }
-    return CurveFitVal({.75, 1.00, 1.25}, {plValues[3], plValues[4], plValues[5]}, 2, loadFactor).calculate();
+    return plValues;
 }
 
 double MotorCurrent::calculateOptimalCurrent() {
@@ -66,14 +69,12 @@ double MotorCurrent::calculateOptimalCurrent() {
 //        plValues[i] = plValues[i]*((((fieldVoltage/ratedVoltage)-1)*(1+(-2*(0.25*i))))+1);
 //    }
     if (loadFactor < 0.251) {
-        CurveFitVal cfv({0, .25, .50}, {plValues[0], plValues[1], plValues[2]}, 2, loadFactor);
-        return cfv.calculate();
+        return CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::ZERO_TO_HALF_LOAD, &plValues[0], loadFactor);
     } else if (loadFactor < 1.251) {
-        CurveFitVal cfv({.25, .50, .75, 1.00, 1.25}, {plValues[1], plValues[2], plValues[3], plValues[4], plValues[5]}, 4, loadFactor);
-        return cfv.calculate();
+        return CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, &plValues[1], loadFactor);
     }
     if (loadFactor > 1.5) {
         loadFactor = 1.5;
     }
-    return CurveFitVal({.75, 1.00, 1.25}, {plValues[3], plValues[4], plValues[5]}, 2, loadFactor).calculate();
+    return CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, &plValues[3], loadFactor);
 }
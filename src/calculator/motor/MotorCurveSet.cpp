@@ -0,0 +1,109 @@
+/**
+ * @brief Contains the definition of functions of MotorCurveSet class.
+ *
+ * The curves reproduce MotorEfficiency::calculate, MotorCurrent::calculateCurrent,
+ * MotorCurrent::calculateOptimalCurrent and MotorPowerFactor::calculate, with the 25% interval values and fit
+ * coefficients calculated in the constructor.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include "calculator/motor/MotorCurveSet.h"
+#include "calculator/motor/MotorEfficiency.h"
+#include "calculator/motor/MotorCurrent.h"
+#include "calculator/motor/EstimateFLA.h"
+#include "calculator/util/CurveFitVal.h"
+
+MotorCurveSet::MotorCurveSet(const Motor::LineFrequency lineFrequency, const double motorRpm,
+                             const Motor::EfficiencyClass efficiencyClass, const double motorRatedPower,
+                             const double specifiedEfficiency, const double ratedVoltage, const double fullLoadAmps)
+        : lineFrequency(lineFrequency), motorRpm(motorRpm), efficiencyClass(efficiencyClass),
+          motorRatedPower(motorRatedPower), specifiedEfficiency(specifiedEfficiency), ratedVoltage(ratedVoltage),
+          fullLoadAmps(fullLoadAmps),
+          efficiency25intervals(MotorEfficiency(lineFrequency, motorRpm, efficiencyClass, motorRatedPower)
+                                        .calculateClass25intervals(specifiedEfficiency))
+{
+    MotorCurrent motorCurrent(motorRatedPower, motorRpm, lineFrequency, efficiencyClass, specifiedEfficiency, 0,
+                              ratedVoltage);
+    current25intervals = motorCurrent.calculatePartLoadCurrents(fullLoadAmps);
+    estimatedFLA = motorCurrent.getEstimatedFLA();
+    optimalCurrent25intervals = EstimateFLA(motorRatedPower, motorRpm, lineFrequency, efficiencyClass,
+                                            specifiedEfficiency, ratedVoltage).calculate();
+
+    kWloss25 = ((1 / efficiency25intervals[0]) - 1) * motorRatedPower * 0.746 * 0.25;
+    kWloss0 = 0.8 * kWloss25;
+    CurveFitVal::fixedNodeCoefficients(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, &efficiency25intervals[0],
+                                       efficiencyMid.data());
+    CurveFitVal::fixedNodeCoefficients(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, &efficiency25intervals[2],
+                                       efficiencyHigh.data());
+
+    currentFit = fit(current25intervals);
+    optimalCurrentFit = fit(optimalCurrent25intervals);
+}
+
+const std::array<double, 151> & MotorCurveSet::getLoadSteps() {
+    static const std::array<double, 151> loadSteps = [] {
+        std::array<double, 151> steps = {};
+        for (std::size_t i = 1; i < steps.size(); ++i) {
+            steps[i] = steps[i - 1] + 0.01;
+        }
+        if (!(steps.back() > 1.5) || steps[steps.size() - 2] > 1.5) {
+            throw std::logic_error("MotorCurveSet::getLoadSteps: last load step must be the first beyond 1.5");
+        }
+        return steps;
+    }();
+    return loadSteps;
+}
+
+MotorCurveSet::PartLoadFit MotorCurveSet::fit(const std::array<double, 6> &values) {
+    PartLoadFit partLoadFit;
+    CurveFitVal::fixedNodeCoefficients(CurveFitVal::FixedNodes::ZERO_TO_HALF_LOAD, &values[0], partLoadFit.low.data());
+    CurveFitVal::fixedNodeCoefficients(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, &values[1], partLoadFit.mid.data());
+    CurveFitVal::fixedNodeCoefficients(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, &values[3],
+                                       partLoadFit.high.data());
+    return partLoadFit;
+}
+
+double MotorCurveSet::evaluate(const PartLoadFit &fit, const double loadFactor) {
+    if (loadFactor < 0.251) {
+        return CurveFitVal::fixedNodePolynomial(CurveFitVal::FixedNodes::ZERO_TO_HALF_LOAD, fit.low.data(), loadFactor);
+    } else if (loadFactor < 1.251) {
+        return CurveFitVal::fixedNodePolynomial(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, fit.mid.data(), loadFactor);
+    }
+    return CurveFitVal::fixedNodePolynomial(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, fit.high.data(),
+                                            loadFactor > 1.5 ? 1.5 : loadFactor);
+}
+
+double MotorCurveSet::efficiency(const double loadFactor) const {
+    if (loadFactor < 0.251) {
+        // linear kW loss between 0% and 25% load, see MotorEfficiency::calculate
+        const double kWloss = kWloss0 + loadFactor * 100 * (kWloss25 - kWloss0) / 25;
+        const double kWshaft = motorRatedPower * 0.746 * (loadFactor);
+        return kWshaft / (kWloss + kWshaft);
+    } else if (loadFactor < 1.251) {
+        return CurveFitVal::fixedNodePolynomial(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, efficiencyMid.data(),
+                                                loadFactor);
+    }
+    return CurveFitVal::fixedNodePolynomial(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, efficiencyHigh.data(),
+                                            loadFactor > 1.5 ? 1.5 : loadFactor);
+}
+
+double MotorCurveSet::current(const double loadFactor) const {
+    return evaluate(currentFit, loadFactor);
+}
+
+double MotorCurveSet::optimalCurrent(const double loadFactor) const {
+    return evaluate(optimalCurrentFit, loadFactor);
+}
+
+double MotorCurveSet::powerFactor(const double loadFactor, const double current, const double efficiency,
+                                  const double voltage) const {
+    if (std::abs(loadFactor) < 0.001) {
+        // At no load all input power is loss, see MotorPowerFactor::calculate
+        return kWloss0 / (460 * sqrt(3) * current / 1000);
+    }
+    return (loadFactor * motorRatedPower * 0.746) / (current * efficiency * voltage * std::sqrt(3) / 1000);
+}
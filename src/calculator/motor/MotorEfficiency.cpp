@@ -15,41 +15,7 @@
 #include "calculator/util/CurveFitVal.h"
 
 double MotorEfficiency::calculate(double loadFactor, double specifiedEfficiency) {
-	if (efficiencyClass == Motor::EfficiencyClass::SPECIFIED && specifiedEfficiency < 0) {
-		throw std::runtime_error("An efficiency must be specified if EfficiencyClass::SPECIFIED is used");
-	}
-
-	std::array<double, 5> motorEfficiency = {};
-    if (efficiencyClass == Motor::EfficiencyClass::ENERGY_EFFICIENT
-        || efficiencyClass == Motor::EfficiencyClass::STANDARD
-        || efficiencyClass == Motor::EfficiencyClass::PREMIUM)
-    {
-	    motorEfficiency = MotorEfficiency(lineFrequency, motorRpm, efficiencyClass, motorRatedPower).calculate25intervals();
-    } else if (efficiencyClass == Motor::EfficiencyClass::SPECIFIED) {
-        // For specified efficiency, you have to first choose the nominal efficiency.
-	    motorEfficiency = MotorEfficiency(lineFrequency, motorRpm, Motor::EfficiencyClass::ENERGY_EFFICIENT,
-	                                      motorRatedPower).calculate25intervals();
-	    auto const stdMotorEffs = MotorEfficiency(lineFrequency, motorRpm, Motor::EfficiencyClass::STANDARD, motorRatedPower).calculate25intervals();
-
-//	    double C = specifiedEfficiency / motorEfficiency[3];
-        if (std::fabs(motorEfficiency[3] - specifiedEfficiency) > std::fabs(stdMotorEffs[3] - specifiedEfficiency)) {
-            //SE chosen
-            const double C = specifiedEfficiency / stdMotorEffs[3];
-	        motorEfficiency = {
-			        {
-					        stdMotorEffs[0] * C, stdMotorEffs[1] * C, stdMotorEffs[2] * C,
-					        stdMotorEffs[4] * C, stdMotorEffs[4] * C
-			        }
-	        };
-        } else { // EE chosen
-            specifiedEfficiency = specifiedEfficiency / 100;
-            const double C = specifiedEfficiency / motorEfficiency[3];
-
-            for (std::size_t i = 0; i < 5; ++i) {
-                motorEfficiency[i] = motorEfficiency[i] * C;
-            }
-        }
-    }
+	std::array<double, 5> const motorEfficiency = calculateClass25intervals(specifiedEfficiency);
 
     /**
      * Calculating the 1% interval values based on the load factor
@@ -86,8 +52,7 @@ double MotorEfficiency::calculate(double loadFactor, double specifiedEfficiency)
          * Pick the 25,50,75,100,and 125% motor efficiency values and do a 4th order polynomial fit.
          * Use the fit coefficients to populate, in 1% load intervals, from 26 to 125% load
          */
-        CurveFitVal cfv({.25, .50, .75, 1.00, 1.25}, {motorEfficiency[0], motorEfficiency[1], motorEfficiency[2], motorEfficiency[3], motorEfficiency[4]}, 4, loadFactor);
-        motorEff = cfv.calculate();
+        motorEff = CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, &motorEfficiency[0], loadFactor);
     } else {
         /**
          * 126 - 150 load factor (1.25 (non-inclusive) - 1.50 (inclusive))
@@ -97,8 +62,7 @@ double MotorEfficiency::calculate(double loadFactor, double specifiedEfficiency)
         if (loadFactor > 1.5) {
             loadFactor = 1.5;
         }
-        CurveFitVal cfv({.75, 1.00, 1.25}, {motorEfficiency[2], motorEfficiency[3], motorEfficiency[4]}, 2, loadFactor);
-        motorEff = cfv.calculate();
+        motorEff = CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, &motorEfficiency[2], loadFactor);
     }
 
     return motorEff;
@@ -451,6 +415,45 @@ const std::array< std::array<double, 4>, 5> MotorEfficiency::determinePartialLoa
 	return {{}};
 }
 
+std::array<double, 5> MotorEfficiency::calculateClass25intervals(double specifiedEfficiency) const {
+	if (efficiencyClass == Motor::EfficiencyClass::SPECIFIED && specifiedEfficiency < 0) {
+		throw std::runtime_error("An efficiency must be specified if EfficiencyClass::SPECIFIED is used");
+	}
+
+	std::array<double, 5> motorEfficiency = {};
+    if (efficiencyClass == Motor::EfficiencyClass::ENERGY_EFFICIENT
+        || efficiencyClass == Motor::EfficiencyClass::STANDARD
+        || efficiencyClass == Motor::EfficiencyClass::PREMIUM)
+    {
+	    motorEfficiency = MotorEfficiency(lineFrequency, motorRpm, efficiencyClass, motorRatedPower).calculate25intervals();
+    } else if (efficiencyClass == Motor::EfficiencyClass::SPECIFIED) {
+        // For specified efficiency, you have to first choose the nominal efficiency.
+	    motorEfficiency = MotorEfficiency(lineFrequency, motorRpm, Motor::EfficiencyClass::ENERGY_EFFICIENT,
+	                                      motorRatedPower).calculate25intervals();
+	    auto const stdMotorEffs = MotorEfficiency(lineFrequency, motorRpm, Motor::EfficiencyClass::STANDARD, motorRatedPower).calculate25intervals();
+
+        if (std::fabs(motorEfficiency[3] - specifiedEfficiency) > std::fabs(stdMotorEffs[3] - specifiedEfficiency)) {
+            //SE chosen
+            const double C = specifiedEfficiency / stdMotorEffs[3];
+	        motorEfficiency = {
+			        {
+					        stdMotorEffs[0] * C, stdMotorEffs[1] * C, stdMotorEffs[2] * C,
+					        stdMotorEffs[4] * C, stdMotorEffs[4] * C
+			        }
+	        };
+        } else { // EE chosen
+            specifiedEfficiency = specifiedEfficiency / 100;
+            const double C = specifiedEfficiency / motorEfficiency[3];
+
+            for (std::size_t i = 0; i < 5; ++i) {
+                motorEfficiency[i] = motorEfficiency[i] * C;
+            }
+        }
+    }
+
+    return motorEfficiency;
+}
+
 std::array<double, 5> MotorEfficiency::calculate25intervals() {
 	// Find the poles and use it as an index
 	int poleCase = Poles(motorRpm, lineFrequency).calculate() / 2 - 1;
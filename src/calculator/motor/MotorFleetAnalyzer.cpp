@@ -0,0 +1,147 @@
+/**
+ * @file
+ * @brief Contains the definition of functions of the MotorFleetAnalyzer class.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "calculator/motor/MotorFleetAnalyzer.h"
+#include "calculator/motor/OptimalMotorSize.h"
+#include "calculator/motor/Poles.h"
+
+MotorFleetAnalyzer::MotorFleetAnalyzer(std::vector<MotorData> catalog, const double sizeMargin,
+                                       const std::size_t maxCandidates, const unsigned threadCount)
+        : catalog(std::move(catalog)), sizeMargin(sizeMargin), maxCandidates(maxCandidates),
+          threadCount(std::max(threadCount, 1u))
+{
+    catalogCurves.reserve(this->catalog.size());
+    for (auto const & motor : this->catalog) {
+        if (motor.getNominalEfficiency() <= 0) {
+            throw std::runtime_error("MotorFleetAnalyzer: every catalog motor needs a nominal efficiency");
+        }
+        catalogCurves.emplace_back(motor.getLineFrequency(), motor.getSynchronousSpeed(),
+                                   Motor::EfficiencyClass::SPECIFIED, motor.getHp(), motor.getNominalEfficiency(), 460,
+                                   0);
+    }
+}
+
+double MotorFleetAnalyzer::annualEnergy(const MotorCurveSet &curves, const InstalledMotor &motor) {
+    double energy = 0;
+    for (auto const & point : motor.loadProfile) {
+        if (point.loadFactor <= 0) {
+            continue;
+        }
+        double const shaftPower = motor.motorRatedPower * point.loadFactor;
+        double const loadFactor = shaftPower / curves.getMotorRatedPower();
+        /// kWe = kW shaft / efficiency
+        double const power = shaftPower * 0.746 / curves.efficiency(loadFactor);
+        energy += power * point.hoursFraction * motor.operatingHours;
+    }
+    return energy / 1000;
+}
+
+MotorFleetAnalyzer::Output MotorFleetAnalyzer::calculate(const InstalledMotor &motor) const {
+    MotorCurveSet const installedCurves(motor.lineFrequency, motor.motorRpm, motor.efficiencyClass,
+                                        motor.motorRatedPower, motor.specifiedEfficiency, motor.ratedVoltage, 0);
+    Output output;
+    output.annualEnergy = annualEnergy(installedCurves, motor);
+    output.annualCost = output.annualEnergy * 1000 * motor.unitCost;
+    output.estimatedFLA = installedCurves.getEstimatedFLA();
+
+    double peakLoadFactor = 0;
+    for (auto const & point : motor.loadProfile) {
+        peakLoadFactor = std::max(peakLoadFactor, point.loadFactor);
+    }
+    double const peakShaftPower = motor.motorRatedPower * peakLoadFactor;
+    output.optimalMotorRatedPower = OptimalMotorSize(peakShaftPower, sizeMargin).calculate();
+
+    int const poles = Poles(motor.motorRpm, motor.lineFrequency).calculate();
+    for (std::size_t i = 0; i < catalog.size(); ++i) {
+        MotorData const & candidate = catalog[i];
+        if (candidate.getLineFrequency() != motor.lineFrequency || candidate.getPoles() != poles
+            || candidate.getVoltageLimit() < motor.ratedVoltage
+            || candidate.getHp() < output.optimalMotorRatedPower) {
+            continue;
+        }
+        Candidate result;
+        result.catalogIndex = i;
+        result.motorRatedPower = candidate.getHp();
+        result.peakLoadFactor = peakShaftPower / candidate.getHp();
+        /// the estimated FLA scales with 460 V over the rated voltage
+        result.estimatedFLA = catalogCurves[i].getEstimatedFLA() * 460 / motor.ratedVoltage;
+        result.annualEnergy = annualEnergy(catalogCurves[i], motor);
+        result.annualCost = result.annualEnergy * 1000 * motor.unitCost;
+        result.annualSavings = output.annualCost - result.annualCost;
+        output.candidates.push_back(result);
+    }
+
+    // ties keep catalog order
+    auto const bySavings = [](const Candidate &a, const Candidate &b) {
+        return a.annualSavings > b.annualSavings
+               || (a.annualSavings == b.annualSavings && a.catalogIndex < b.catalogIndex);
+    };
+    if (maxCandidates > 0 && maxCandidates < output.candidates.size()) {
+        std::partial_sort(output.candidates.begin(), output.candidates.begin() + maxCandidates,
+                          output.candidates.end(), bySavings);
+        output.candidates.resize(maxCandidates);
+    } else {
+        std::sort(output.candidates.begin(), output.candidates.end(), bySavings);
+    }
+    return output;
+}
+
+std::vector<MotorFleetAnalyzer::Output> MotorFleetAnalyzer::calculate(const std::vector<InstalledMotor> &fleet) const {
+    std::vector<Output> outputs(fleet.size());
+    auto const evaluate = [this, &fleet, &outputs](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            outputs[i] = calculate(fleet[i]);
+        }
+    };
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    // no threads without pthread support in the wasm build
+    std::size_t const workers = 1;
+#else
+    std::size_t const workers = std::min<std::size_t>(threadCount, fleet.size());
+#endif
+    if (workers <= 1) {
+        evaluate(0, fleet.size());
+        return outputs;
+    }
+
+    // contiguous blocks of motors per thread; the calling thread takes the first block
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(workers);
+    std::size_t const blockSize = (fleet.size() + workers - 1) / workers;
+    for (std::size_t w = 1; w < workers; ++w) {
+        std::size_t const first = std::min(w * blockSize, fleet.size());
+        std::size_t const last = std::min(first + blockSize, fleet.size());
+        threads.emplace_back([&evaluate, &errors, w, first, last]() {
+            try {
+                evaluate(first, last);
+            } catch (...) {
+                errors[w] = std::current_exception();
+            }
+        });
+    }
+    try {
+        evaluate(0, std::min(blockSize, fleet.size()));
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    for (auto const & error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return outputs;
+}
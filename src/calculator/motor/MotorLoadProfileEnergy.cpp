@@ -0,0 +1,55 @@
+/**
+ * @file
+ * @brief Contains the definition of functions of the MotorLoadProfileEnergy class.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <map>
+#include "calculator/motor/MotorLoadProfileEnergy.h"
+#include "calculator/motor/MotorShaftPower.h"
+
+MotorLoadProfileEnergy::Output MotorLoadProfileEnergy::calculate(const std::vector<Bin> &histogram) const {
+    Output output = {0, 0, 0, 0, 0, 0, 0, 0};
+    double loadHours = 0;
+    for (auto const & bin : histogram) {
+        output.totalHours += bin.hours;
+        if (bin.measurement <= 0 || bin.hours <= 0) {
+            continue;
+        }
+        bool const byPower = loadEstimationMethod == Motor::LoadEstimationMethod::POWER;
+        auto const point = MotorShaftPower(curves, byPower ? bin.measurement : 0, fieldVoltage, loadEstimationMethod,
+                                           byPower ? 0 : bin.measurement, loadSolver).calculate();
+        output.operatingHours += bin.hours;
+        output.inputEnergy += point.power * bin.hours;
+        output.shaftEnergy += point.shaftPower * 0.746 * bin.hours;
+        loadHours += point.loadFactor * bin.hours;
+        output.peakLoadFactor = std::max(output.peakLoadFactor, point.loadFactor);
+    }
+
+    /// kWh to MWh
+    output.inputEnergy /= 1000;
+    output.shaftEnergy /= 1000;
+    output.lossEnergy = output.inputEnergy - output.shaftEnergy;
+    if (output.operatingHours > 0) {
+        output.averageLoadFactor = loadHours / output.operatingHours;
+        output.averageEfficiency = output.shaftEnergy / output.inputEnergy;
+    }
+    return output;
+}
+
+MotorLoadProfileEnergy::Output MotorLoadProfileEnergy::calculate(const std::vector<double> &series,
+                                                                 const double hoursPerMeasurement) const {
+    std::map<double, double> hoursAt;
+    for (auto const measurement : series) {
+        hoursAt[measurement] += hoursPerMeasurement;
+    }
+    std::vector<Bin> histogram;
+    histogram.reserve(hoursAt.size());
+    for (auto const & bin : hoursAt) {
+        histogram.push_back({bin.first, bin.second});
+    }
+    return calculate(histogram);
+}
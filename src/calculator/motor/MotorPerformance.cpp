@@ -16,6 +16,15 @@ MotorPerformance::Output MotorPerformance::calculate() {
     double current = 0;
     double efficiency = 0;
     double powerFactor = 0;
+
+    if (curves) {
+        double const calculatedEfficiency = curves->efficiency(loadFactor);
+        double const calculatedCurrent = curves->current(loadFactor);
+        powerFactor = curves->powerFactor(loadFactor, calculatedCurrent, calculatedEfficiency, ratedVoltage) * 100;
+        efficiency = calculatedEfficiency * 100;
+        current = calculatedCurrent / fullLoadAmps * 100;
+        return {current, efficiency, powerFactor};
+    }
     
     MotorEfficiency motorEfficiency(lineFrequency, motorRpm, efficiencyClass, motorRatedPower);
     double calculatedEfficiency = motorEfficiency.calculate(loadFactor, specifiedEfficiency);
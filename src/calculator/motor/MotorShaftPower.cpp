@@ -1,25 +1,43 @@
 #include <cmath>
 #include "calculator/motor/MotorShaftPower.h"
-#include "calculator/motor/MotorEfficiency.h"
 #include "calculator/motor/MotorPower.h"
-#include "calculator/motor/MotorCurrent.h"
-#include "calculator/motor/MotorPowerFactor.h"
 
 MotorShaftPower::Output MotorShaftPower::calculate() {
+    if (curves) {
+        return calculateFromCurves(*curves);
+    }
+    return calculateFromCurves(MotorCurveSet(lineFrequency, motorRPM, efficiencyClass, motorRatedPower,
+                                             specifiedEfficiency, ratedVoltage, fullLoadAmps));
+}
+
+MotorShaftPower::Output MotorShaftPower::calculateFromCurves(const MotorCurveSet &curves) const {
     double powerFactor, efficiency, current, power, estimatedFLA;
 
     if (loadEstimationMethod == Motor::LoadEstimationMethod::POWER) {
         double tempLoadFraction = 0.01;
 	    double powerE1 = 0, powerE2 = 0, lf1 = 0, lf2 = 0, eff1 = 0, eff2 = 0, pf1 = 0, pf2 = 0;
+        if (loadSolver == Motor::LoadSolver::BISECTION) {
+            /// Jump to the load step the stepping below stops at, starting from the values of the step before
+            auto const & loadSteps = MotorCurveSet::getLoadSteps();
+            auto const electricPower = [this, &curves](double const loadFraction, double &eff, double &pf) {
+                double const loadCurrent = curves.current(loadFraction);
+                eff = curves.efficiency(loadFraction);
+                pf = curves.powerFactor(loadFraction, loadCurrent, eff, ratedVoltage);
+                return MotorPower(ratedVoltage, loadCurrent, pf).calculate();
+            };
+            std::size_t const step = MotorCurveSet::bisectLoadSteps(1, [&](std::size_t const i) {
+                return electricPower(loadSteps[i], efficiency, powerFactor) > fieldPower || loadSteps[i] > 1.5;
+            });
+            if (step > 1) {
+                lf1 = loadSteps[step - 1];
+                powerE1 = electricPower(lf1, eff1, pf1);
+            }
+            tempLoadFraction = loadSteps[step];
+        }
         while (true) {
-            MotorCurrent motorCurrent(motorRatedPower, motorRPM, lineFrequency, efficiencyClass,
-                                      specifiedEfficiency, tempLoadFraction, ratedVoltage);
-            current = motorCurrent.calculateCurrent(fullLoadAmps);
-            MotorEfficiency motorEfficiency(lineFrequency, motorRPM, efficiencyClass, motorRatedPower);
-            efficiency = motorEfficiency.calculate(tempLoadFraction, specifiedEfficiency);
-            MotorPowerFactor motorPowerFactor(lineFrequency, motorRPM, efficiencyClass, specifiedEfficiency,
-                                              motorRatedPower, tempLoadFraction, current, efficiency, ratedVoltage);
-            powerFactor = motorPowerFactor.calculate();
+            current = curves.current(tempLoadFraction);
+            efficiency = curves.efficiency(tempLoadFraction);
+            powerFactor = curves.powerFactor(tempLoadFraction, current, efficiency, ratedVoltage);
             MotorPower motorPower(ratedVoltage, current, powerFactor);
             power = motorPower.calculate();
             if (power > fieldPower || tempLoadFraction > 1.5) {
@@ -27,7 +45,7 @@ MotorShaftPower::Output MotorShaftPower::calculate() {
                 lf2 = tempLoadFraction;
                 eff2 = efficiency;
                 pf2 = powerFactor;
-                estimatedFLA = motorCurrent.getEstimatedFLA();
+                estimatedFLA = curves.getEstimatedFLA();
                 break;
             } else {
                 powerE1 = power;
@@ -62,36 +80,33 @@ MotorShaftPower::Output MotorShaftPower::calculate() {
     } else { /// When the load estimation method is Current.
         double tempLoadFraction = 0.00;
         double powerE1, powerE2, lf1, lf2, eff1, eff2, current1, current2;
+        if (loadSolver == Motor::LoadSolver::BISECTION) {
+            auto const & loadSteps = MotorCurveSet::getLoadSteps();
+            tempLoadFraction = loadSteps[MotorCurveSet::bisectLoadSteps(0, [&](std::size_t const i) {
+                return curves.current(loadSteps[i]) > fieldCurrent || loadSteps[i] > 1.5;
+            })];
+        }
         while (true) {
-            MotorCurrent motorCurrent(motorRatedPower, motorRPM, lineFrequency, efficiencyClass,
-                                      specifiedEfficiency, tempLoadFraction, ratedVoltage);
-            current = motorCurrent.calculateCurrent(fullLoadAmps);
+            current = curves.current(tempLoadFraction);
             if (current > fieldCurrent || tempLoadFraction > 1.5) {
-                MotorEfficiency motorEfficiency(lineFrequency, motorRPM, efficiencyClass, motorRatedPower);
-                efficiency = motorEfficiency.calculate(tempLoadFraction, specifiedEfficiency);
-                MotorPowerFactor motorPowerFactor(lineFrequency, motorRPM, efficiencyClass, specifiedEfficiency,
-                                                  motorRatedPower, tempLoadFraction, current, efficiency, ratedVoltage);
-                powerFactor = motorPowerFactor.calculate();
+                efficiency = curves.efficiency(tempLoadFraction);
+                powerFactor = curves.powerFactor(tempLoadFraction, current, efficiency, ratedVoltage);
                 MotorPower motorPower(ratedVoltage, current, powerFactor);
                 power = motorPower.calculate();
                 current2 = current;
                 powerE2 = power;
                 lf2 = tempLoadFraction;
                 eff2 = efficiency;
-                estimatedFLA = motorCurrent.getEstimatedFLA();
+                estimatedFLA = curves.getEstimatedFLA();
                 break;
             }
             tempLoadFraction += 0.01;
         }
         /// Dropping load fraction by 0.01
         tempLoadFraction -= 0.01;
-        MotorCurrent motorCurrent1(motorRatedPower, motorRPM, lineFrequency, efficiencyClass, specifiedEfficiency,
-                                   tempLoadFraction, ratedVoltage);
-        current = motorCurrent1.calculateCurrent(fullLoadAmps);
-        MotorEfficiency motorEfficiency(lineFrequency, motorRPM, efficiencyClass, motorRatedPower);
-        efficiency = motorEfficiency.calculate(tempLoadFraction, specifiedEfficiency);
-        powerFactor = MotorPowerFactor(lineFrequency, motorRPM, efficiencyClass, specifiedEfficiency,
-                                       motorRatedPower, tempLoadFraction, current, efficiency, ratedVoltage).calculate();
+        current = curves.current(tempLoadFraction);
+        efficiency = curves.efficiency(tempLoadFraction);
+        powerFactor = curves.powerFactor(tempLoadFraction, current, efficiency, ratedVoltage);
         MotorPower motorPower(ratedVoltage, current, powerFactor);
         power = motorPower.calculate();
         current1 = current;
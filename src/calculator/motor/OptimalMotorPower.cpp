@@ -8,15 +8,21 @@
  *
  */
 
-#include <calculator/motor/MotorCurrent.h>
-#include <calculator/motor/Poles.h>
+#include <cmath>
 #include "calculator/motor/OptimalMotorPower.h"
-#include "calculator/motor/MotorEfficiency.h"
-#include "calculator/motor/MotorPowerFactor.h"
 #include "calculator/motor/MotorPower.h"
 
 
 OptimalMotorPower::Output OptimalMotorPower::calculate() {
+    if (curves) {
+        return calculateFromCurves(*curves);
+    }
+    // the optimal current does not depend on the full load amps
+    return calculateFromCurves(MotorCurveSet(lineFrequency, motorRPM, efficiencyClass, motorRatedPower,
+                                             specifiedEfficiency, ratedVoltage, 0));
+}
+
+OptimalMotorPower::Output OptimalMotorPower::calculateFromCurves(const MotorCurveSet &curves) const {
     double tempLoadFraction = 0.00;
     double mspkW;
     double tempMsp = 0, tempMsp1 = 0, tempMsp2 = 0, powerE1 = 0, powerE2 = 0;
@@ -24,18 +30,35 @@ OptimalMotorPower::Output OptimalMotorPower::calculate() {
 
     double power, efficiency, current, powerFactor;
 
+    if (loadSolver == Motor::LoadSolver::BISECTION) {
+        /// Jump to the load step the stepping below stops at, starting from the values of the step before
+        auto const & loadSteps = MotorCurveSet::getLoadSteps();
+        auto const shaftPower = [this, &curves](double const loadFraction, double &kW, double &eff, double &amps) {
+            amps = curves.optimalCurrent(loadFraction)
+                   * ((((fieldVoltage / ratedVoltage) - 1) * (1 + (-2 * loadFraction))) + 1);
+            eff = curves.efficiency(loadFraction);
+            double const pf = curves.powerFactor(loadFraction, amps, eff, fieldVoltage);
+            kW = MotorPower(fieldVoltage, amps, pf).calculate();
+            return kW * eff;
+        };
+        std::size_t const step = MotorCurveSet::bisectLoadSteps(0, [&](std::size_t const i) {
+            return shaftPower(loadSteps[i], power, efficiency, current) > optimalMotorShaftPower * 0.746
+                   || loadSteps[i] > 1.5;
+        });
+        if (step > 0) {
+            lf = loadSteps[step - 1];
+            tempMsp1 = shaftPower(lf, powerE1, eff1, current1);
+        }
+        tempLoadFraction = loadSteps[step];
+    }
+
     while (true) {
-        MotorCurrent optimalMotorCurrent(motorRatedPower, motorRPM, lineFrequency, efficiencyClass,
-                                         specifiedEfficiency, tempLoadFraction, ratedVoltage);
-        current = optimalMotorCurrent.calculateOptimalCurrent();
+        current = curves.optimalCurrent(tempLoadFraction);
         //Adjustment to current based on measured Voltage
         current = current * ((((fieldVoltage / ratedVoltage) - 1) * (1 + (-2 * tempLoadFraction))) + 1);
-        MotorEfficiency motorEfficiency(lineFrequency, motorRPM, efficiencyClass, motorRatedPower);
-        efficiency = motorEfficiency.calculate(tempLoadFraction, specifiedEfficiency);
+        efficiency = curves.efficiency(tempLoadFraction);
         //Similar to motorpowerfactor in existing case instead of ratedVoltage
-        MotorPowerFactor motorPowerFactor(lineFrequency, motorRPM, efficiencyClass, specifiedEfficiency,
-                                          motorRatedPower, tempLoadFraction, current, efficiency, fieldVoltage);
-        powerFactor = motorPowerFactor.calculate();
+        powerFactor = curves.powerFactor(tempLoadFraction, current, efficiency, fieldVoltage);
 
         power = MotorPower(fieldVoltage, current, powerFactor).calculate();
         tempMsp = power * efficiency;
@@ -0,0 +1,78 @@
+/**
+ * @brief Contains the implementations of the HeadToolBatch methods.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <stdexcept>
+#include "calculator/pump/HeadToolBatch.h"
+
+namespace {
+    /// same constants as HeadToolBase
+    const double gravity = 32.1740;
+    const double PI = 3.141592653589793238463;
+
+    /**
+     * Velocity head per gpm squared, see HeadToolBase::velocity and HeadToolBase::velocityHead
+     * @param diameter double, pipe diameter in inches
+     */
+    double velocityHeadCoefficient(const double diameter) {
+        double const area = PI * (diameter / 12) / 2.0 * (diameter / 12) / 2.0;
+        double const cfsPerGpm = 1 / 448.8311693;
+        return (cfsPerGpm / area) * (cfsPerGpm / area) / 2.0 / gravity;
+    }
+}
+
+HeadToolBatch::HeadToolBatch(const Suction suction, const double specificGravity, const double suctionPipeDiameter,
+                             const double suctionElevation, const double suctionLineLossCoefficients,
+                             const double dischargePipeDiameter, const double dischargeGaugeElevation,
+                             const double dischargeLineLossCoefficients)
+        : elevationHead(dischargeGaugeElevation - suctionElevation),
+          pressureHeadCoefficient(1 / 0.432750001 / specificGravity),
+          suctionVelocityHeadCoefficient(velocityHeadCoefficient(suctionPipeDiameter)),
+          dischargeVelocityHeadCoefficient(velocityHeadCoefficient(dischargePipeDiameter)),
+          suctionLineLossCoefficients(suctionLineLossCoefficients),
+          dischargeLineLossCoefficients(dischargeLineLossCoefficients),
+          suctionVelocityHeadSign(suction == Suction::GAUGE ? 1 : 0),
+          flowHeadCoefficient(dischargeVelocityHeadCoefficient * (1 + dischargeLineLossCoefficients)
+                              + suctionVelocityHeadCoefficient * (suctionLineLossCoefficients - suctionVelocityHeadSign))
+{}
+
+void HeadToolBatch::calculate(const double *flowRates, const double *suctionPressures,
+                              const double *dischargePressures, double *pumpHeads, const std::size_t count) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        double const flowSquared = flowRates[i] * flowRates[i];
+        pumpHeads[i] = elevationHead + (dischargePressures[i] - suctionPressures[i]) * pressureHeadCoefficient
+                       + flowHeadCoefficient * flowSquared;
+    }
+}
+
+HeadToolBatch::Output HeadToolBatch::calculate(const std::vector<double> &flowRates,
+                                               const std::vector<double> &suctionPressures,
+                                               const std::vector<double> &dischargePressures) const {
+    std::size_t const count = flowRates.size();
+    if (suctionPressures.size() != count || dischargePressures.size() != count) {
+        throw std::runtime_error("HeadToolBatch: one suction and one discharge pressure per flow rate is required");
+    }
+
+    Output output;
+    output.elevationHead = elevationHead;
+    for (auto column : {&output.pressureHead, &output.velocityHeadDifferential, &output.suctionHead,
+                        &output.dischargeHead, &output.pumpHead}) {
+        column->resize(count);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        double const flowSquared = flowRates[i] * flowRates[i];
+        double const velocityHeadSuction = suctionVelocityHeadCoefficient * flowSquared;
+        double const velocityHeadDischarge = dischargeVelocityHeadCoefficient * flowSquared;
+
+        output.pressureHead[i] = (dischargePressures[i] - suctionPressures[i]) * pressureHeadCoefficient;
+        output.velocityHeadDifferential[i] = velocityHeadDischarge - suctionVelocityHeadSign * velocityHeadSuction;
+        output.suctionHead[i] = suctionLineLossCoefficients * velocityHeadSuction;
+        output.dischargeHead[i] = dischargeLineLossCoefficients * velocityHeadDischarge;
+        output.pumpHead[i] = elevationHead + output.pressureHead[i] + output.velocityHeadDifferential[i]
+                             + output.suctionHead[i] + output.dischargeHead[i];
+    }
+    return output;
+}
@@ -9,41 +9,72 @@
  */
 
 #include <cmath>
+#include <algorithm>
+#include <limits>
 #include "calculator/pump/OptimalPumpEfficiency.h"
 #include "calculator/pump/OptimalPrePumpEff.h"
-#include "calculator/pump/OptimalSpecificSpeed.h"
 #include "calculator/pump/OptimalSpecificSpeedCorrection.h"
 #include "calculator/pump/OptimalDeviationFactor.h"
 
+namespace {
+    /// number of operating points per block of the batch calculation, sized for the scratch arrays on the stack
+    const std::size_t blockSize = 64;
+
+    /// x^0.75 = sqrt(x) * x^0.25
+    inline double powThreeQuarters(const double x) {
+        double const root = std::sqrt(x);
+        return root * std::sqrt(root);
+    }
+}
+
 double OptimalPumpEfficiency::calculate() {
+    calculate(style, kinematicViscosity, stageCount, &flowRate, &head, &rpm, &optimalEfficiency, 1);
+    return optimalEfficiency;
+}
 
-    OptimalPrePumpEff optimalPrePumpEff(style, flowRate);
-    prePumpEfficiency = optimalPrePumpEff.calculate();
-    /*
-     * You may have individual functions for each also.
-     */
+void OptimalPumpEfficiency::calculate(const Pump::Style style, const double kinematicViscosity,
+                                      const double stageCount, const double *flowRates, const double *heads,
+                                      const double *rpms, double *efficiencies, const std::size_t count) {
     /*
      * Viscosity Correction Factor
+     * parameterB = 26.6 * kinematicViscosity^0.5 * head^0.0625 / (flowRate^0.375 * rpm^0.25)
      */
-    double parameterB = 26.6 * (std::pow(kinematicViscosity, 0.5) * std::pow(head, 0.0625))
-                        / (std::pow(flowRate, 0.375) * std::pow(rpm, 0.25));
-    double viscosityCorrectionFactor = std::fmin(1, (std::pow(parameterB, -(0.0547 * std::pow(parameterB, 0.69)))));
-    /*
-     * Speed Correction
-     */
-    OptimalSpecificSpeed optimalSpecificSpeed(rpm,flowRate, head, stageCount);
-    double specificSpeed = optimalSpecificSpeed.calculate();
-    OptimalSpecificSpeedCorrection optimalSpecificSpeedCorrection(style, specificSpeed);
-    double speedCorrection = optimalSpecificSpeedCorrection.calculate();
-    /*
-     * positiveDeviationFactor
-     */
-    OptimalDeviationFactor optimalDeviationFactor(flowRate);
-    double positiveDeviationFactor = optimalDeviationFactor.calculate();
-    /*
-     * Optimal Efficiency
-     */
-    prePumpEfficiency = prePumpEfficiency / 100;
-    optimalEfficiency = (prePumpEfficiency * viscosityCorrectionFactor - speedCorrection) * positiveDeviationFactor;
-    return optimalEfficiency;
+    double const fluidTerm = 26.6 * std::sqrt(kinematicViscosity);
+    double speed = std::numeric_limits<double>::quiet_NaN(), speedTerm = 0;
+
+    double prePumpEfficiency[blockSize], viscosityCorrectionFactor[blockSize];
+    double specificSpeed[blockSize], speedCorrection[blockSize];
+    for (std::size_t first = 0; first < count; first += blockSize) {
+        std::size_t const n = std::min(blockSize, count - first);
+        const double * q = flowRates + first;
+        const double * h = heads + first;
+        const double * speeds = rpms + first;
+
+        OptimalPrePumpEff::calculate(style, q, prePumpEfficiency, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (speeds[i] != speed) {
+                // operating points usually share the pump speed
+                speed = speeds[i];
+                speedTerm = std::sqrt(std::sqrt(speed));
+            }
+            double const sqrtFlow = std::sqrt(q[i]);
+            double const flowTerm = std::sqrt(sqrtFlow * std::sqrt(sqrtFlow));
+            double const headTerm = std::sqrt(std::sqrt(std::sqrt(std::sqrt(h[i]))));
+            double const parameterB = fluidTerm * headTerm / (flowTerm * speedTerm);
+            // parameterB^-(0.0547 * parameterB^0.69)
+            double const logB = std::log(parameterB);
+            viscosityCorrectionFactor[i] = std::fmin(1, std::exp(-0.0547 * std::exp(0.69 * logB) * logB));
+            /*
+             * Speed Correction, see OptimalSpecificSpeed
+             */
+            specificSpeed[i] = speeds[i] * sqrtFlow / powThreeQuarters(h[i] / stageCount);
+        }
+        OptimalSpecificSpeedCorrection::calculate(style, specificSpeed, speedCorrection, n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            double const positiveDeviationFactor = OptimalDeviationFactor(q[i]).calculate();
+            efficiencies[first + i] = (prePumpEfficiency[i] / 100 * viscosityCorrectionFactor[i] - speedCorrection[i])
+                                      * positiveDeviationFactor;
+        }
+    }
 }
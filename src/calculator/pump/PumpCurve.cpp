@@ -0,0 +1,84 @@
+/**
+ * @brief Contains the implementations of the PumpCurve methods.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "calculator/pump/PumpCurve.h"
+
+PumpCurve::PumpCurve(const double ratedSpeed, std::vector<double> headCoefficients,
+                     std::vector<double> efficiencyCoefficients, const double maxFlowRate)
+        : ratedSpeed(ratedSpeed), headCoefficients(std::move(headCoefficients)),
+          efficiencyCoefficients(std::move(efficiencyCoefficients)), maxFlowRate(maxFlowRate)
+{
+    if (this->headCoefficients.empty() || this->efficiencyCoefficients.empty()) {
+        throw std::runtime_error("PumpCurve: head and efficiency coefficients are required");
+    }
+    if (ratedSpeed <= 0 || maxFlowRate <= 0) {
+        throw std::runtime_error("PumpCurve: rated speed and maximum flow rate must be positive");
+    }
+}
+
+PumpCurve::PumpCurve(const double ratedSpeed, std::vector<Point> points)
+        : ratedSpeed(ratedSpeed), points(std::move(points)), maxFlowRate(0)
+{
+    if (this->points.size() < 2 || this->points.front().flowRate != 0) {
+        throw std::runtime_error("PumpCurve: a tabulated curve needs at least 2 points, starting at shutoff");
+    }
+    for (std::size_t i = 1; i < this->points.size(); ++i) {
+        if (this->points[i].flowRate <= this->points[i - 1].flowRate) {
+            throw std::runtime_error("PumpCurve: tabulated flow rates must be increasing");
+        }
+    }
+    if (ratedSpeed <= 0) {
+        throw std::runtime_error("PumpCurve: rated speed must be positive");
+    }
+    maxFlowRate = this->points.back().flowRate;
+}
+
+std::size_t PumpCurve::segment(const double flowRate) const {
+    auto const upper = std::upper_bound(points.begin() + 1, points.end() - 1, flowRate,
+                                        [](double q, const Point &point) { return q < point.flowRate; });
+    return upper - points.begin() - 1;
+}
+
+double PumpCurve::head(const double flowRate) const {
+    if (points.empty()) {
+        double head = 0;
+        for (auto c = headCoefficients.rbegin(); c != headCoefficients.rend(); ++c) {
+            head = head * flowRate + *c;
+        }
+        return head;
+    }
+    auto const & p0 = points[segment(flowRate)];
+    return p0.head + headSlope(flowRate) * (flowRate - p0.flowRate);
+}
+
+double PumpCurve::headSlope(const double flowRate) const {
+    if (points.empty()) {
+        double slope = 0;
+        for (std::size_t i = headCoefficients.size() - 1; i > 0; --i) {
+            slope = slope * flowRate + i * headCoefficients[i];
+        }
+        return slope;
+    }
+    std::size_t const i = segment(flowRate);
+    return (points[i + 1].head - points[i].head) / (points[i + 1].flowRate - points[i].flowRate);
+}
+
+double PumpCurve::efficiency(const double flowRate) const {
+    if (points.empty()) {
+        double efficiency = 0;
+        for (auto c = efficiencyCoefficients.rbegin(); c != efficiencyCoefficients.rend(); ++c) {
+            efficiency = efficiency * flowRate + *c;
+        }
+        return efficiency;
+    }
+    std::size_t const i = segment(flowRate);
+    auto const & p0 = points[i], & p1 = points[i + 1];
+    return p0.efficiency + (p1.efficiency - p0.efficiency) * (flowRate - p0.flowRate) / (p1.flowRate - p0.flowRate);
+}
@@ -0,0 +1,66 @@
+/**
+ * @brief Contains the implementations of the PumpSystemOperatingPoint methods.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <stdexcept>
+#include "calculator/pump/PumpSystemOperatingPoint.h"
+#include "calculator/pump/OptimalPumpShaftPower.h"
+#include "calculator/motor/OptimalMotorShaftPower.h"
+#include "calculator/motor/OptimalMotorPower.h"
+#include "calculator/util/SafeguardedNewton.h"
+
+double PumpSystemOperatingPoint::intersect(const double speedRatio) const {
+    double const r2 = speedRatio * speedRatio;
+    double const k = systemCurve.getLossCoefficient();
+    // pump head less system head, positive below the intersection
+    auto const excess = [&](double q) {
+        return r2 * pumpCurve.head(q / speedRatio) - systemCurve.head(q);
+    };
+    auto const slope = [&](double q) {
+        return speedRatio * pumpCurve.headSlope(q / speedRatio) - 2 * k * q;
+    };
+
+    double const high = speedRatio * pumpCurve.getMaxFlowRate();
+    double const fLow = excess(0), fHigh = excess(high);
+    if (fLow <= 0) {
+        return 0;
+    }
+    if (fHigh > 0) {
+        throw std::runtime_error("PumpSystemOperatingPoint: the system curve does not meet the pump curve within its flow range");
+    }
+    return SafeguardedNewton(excess, slope, 1e-12 * high).calculate(0, high, fLow, fHigh);
+}
+
+PumpSystemOperatingPoint::Output PumpSystemOperatingPoint::calculate(const double speed) const {
+    if (speed <= 0) {
+        throw std::runtime_error("PumpSystemOperatingPoint: speed must be positive");
+    }
+    double const speedRatio = speed / pumpCurve.getRatedSpeed();
+    double const flowRate = intersect(speedRatio);
+    if (flowRate == 0) {
+        return {speed, 0, speedRatio * speedRatio * pumpCurve.head(0), 0, 0, 0, 0, 0, 0, 0};
+    }
+
+    double const head = systemCurve.head(flowRate);
+    double const pumpEfficiency = pumpCurve.efficiency(flowRate / speedRatio);
+    if (pumpEfficiency <= 0) {
+        throw std::runtime_error("PumpSystemOperatingPoint: pump efficiency at the operating point must be positive");
+    }
+    double const pumpShaftPower = OptimalPumpShaftPower(flowRate, head, specificGravity, pumpEfficiency).calculate();
+    auto const shaft = OptimalMotorShaftPower(pumpShaftPower, drive, specifiedDriveEfficiency).calculate();
+    auto const motor = OptimalMotorPower(motorCurves, fieldVoltage, shaft.motorShaftPower, loadSolver).calculate();
+    return {speed, flowRate, head, pumpEfficiency, shaft.driveEfficiency, pumpShaftPower, shaft.motorShaftPower,
+            motor.efficiency, motor.loadFactor, motor.power};
+}
+
+std::vector<PumpSystemOperatingPoint::Output> PumpSystemOperatingPoint::calculate(const std::vector<double> &speeds) const {
+    std::vector<Output> outputs;
+    outputs.reserve(speeds.size());
+    for (auto const speed : speeds) {
+        outputs.push_back(calculate(speed));
+    }
+    return outputs;
+}
@@ -0,0 +1,76 @@
+/**
+ * @brief Contains the implementations of the SystemCurve methods.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include "calculator/pump/SystemCurve.h"
+
+SystemCurve SystemCurve::fit(const std::vector<Point> &points) {
+    if (points.size() < 2) {
+        throw std::runtime_error("SystemCurve: at least two operating points are required for a fit");
+    }
+
+    // linear regression of head on the flow rate squared, about the means for accuracy with large flow rates
+    double meanX = 0, meanHead = 0;
+    for (auto const & point : points) {
+        meanX += point.flowRate * point.flowRate;
+        meanHead += point.head;
+    }
+    meanX /= points.size();
+    meanHead /= points.size();
+
+    double sxx = 0, sxh = 0;
+    for (auto const & point : points) {
+        double const dx = point.flowRate * point.flowRate - meanX;
+        sxx += dx * dx;
+        sxh += dx * (point.head - meanHead);
+    }
+    if (sxx <= 0) {
+        throw std::runtime_error("SystemCurve: at least two distinct flow rates are required for a fit");
+    }
+    double const lossCoefficient = sxh / sxx;
+    return {meanHead - lossCoefficient * meanX, lossCoefficient};
+}
+
+SystemCurve SystemCurve::fit(const double staticHead, const std::vector<Point> &points) {
+    double sxx = 0, sxh = 0;
+    for (auto const & point : points) {
+        double const x = point.flowRate * point.flowRate;
+        sxx += x * x;
+        sxh += x * (point.head - staticHead);
+    }
+    if (sxx <= 0) {
+        throw std::runtime_error("SystemCurve: an operating point with flow is required for a fit");
+    }
+    return {staticHead, sxh / sxx};
+}
+
+void SystemCurve::head(const double *flowRates, double *heads, const std::size_t count) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        heads[i] = staticHead + lossCoefficient * flowRates[i] * flowRates[i];
+    }
+}
+
+double SystemCurve::flowRate(const double head) const {
+    if (head <= staticHead || lossCoefficient <= 0) {
+        return 0;
+    }
+    return std::sqrt((head - staticHead) / lossCoefficient);
+}
+
+std::vector<SystemCurve::Point> SystemCurve::curve(const double maxFlowRate, const std::size_t pointCount) const {
+    if (pointCount < 2) {
+        throw std::runtime_error("SystemCurve: a curve needs at least two points");
+    }
+    std::vector<Point> points(pointCount);
+    double const step = maxFlowRate / (pointCount - 1);
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        double const flowRate = i + 1 == pointCount ? maxFlowRate : step * i;
+        points[i] = {flowRate, head(flowRate)};
+    }
+    return points;
+}
@@ -15,6 +15,50 @@
 #include <vector>
 #include "calculator/util/CurveFitVal.h"
 
+namespace {
+    /**
+     * Inverse Vandermonde matrices of the fixed node sets, row i gives the coefficient of x^i from the y coordinates
+     */
+    constexpr double zeroToHalfLoadInverse[3][3] = {
+            {1, 0, 0},
+            {-6, 8, -2},
+            {8, -16, 8}
+    };
+
+    constexpr double quarterTo125LoadInverse[5][5] = {
+            {5, -10, 10, -5, 1},
+            {-77.0 / 3, 214.0 / 3, -78, 122.0 / 3, -25.0 / 3},
+            {142.0 / 3, -472.0 / 3, 196, -328.0 / 3, 70.0 / 3},
+            {-112.0 / 3, 416.0 / 3, -192, 352.0 / 3, -80.0 / 3},
+            {32.0 / 3, -128.0 / 3, 64, -128.0 / 3, 32.0 / 3}
+    };
+
+    constexpr double threeQuarterTo125LoadInverse[3][3] = {
+            {10, -15, 6},
+            {-18, 32, -14},
+            {8, -16, 8}
+    };
+
+    template <std::size_t N>
+    void fitCoefficients(const double (&inverse)[N][N], const double *ycoord, double *coeff) {
+        for (std::size_t i = 0; i < N; ++i) {
+            coeff[i] = 0;
+            for (std::size_t j = 0; j < N; ++j) {
+                coeff[i] += inverse[i][j] * ycoord[j];
+            }
+        }
+    }
+
+    template <std::size_t N>
+    double evaluate(const double *coeff, const double x) {
+        double curveFitVal = coeff[N - 1];
+        for (std::size_t i = N - 1; i > 0; --i) {
+            curveFitVal = curveFitVal * x + coeff[i - 1];
+        }
+        return curveFitVal;
+    }
+}
+
 /**
  * Given a set of x and y coordinates and degree of polynomial curve to fit, it calculates the curve fit value
  * for a particular x coordinate value (read load factor here).
@@ -32,6 +76,32 @@ double CurveFitVal::calculate(double fitValue) const {
     return curveFitVal;
 }
 
+std::size_t CurveFitVal::fixedNodeCount(const FixedNodes nodes) {
+    return nodes == FixedNodes::QUARTER_TO_125_LOAD ? 5 : 3;
+}
+
+void CurveFitVal::fixedNodeCoefficients(const FixedNodes nodes, const double *ycoord, double *coeff) {
+    switch (nodes) {
+        case FixedNodes::ZERO_TO_HALF_LOAD:
+            return fitCoefficients(zeroToHalfLoadInverse, ycoord, coeff);
+        case FixedNodes::QUARTER_TO_125_LOAD:
+            return fitCoefficients(quarterTo125LoadInverse, ycoord, coeff);
+        case FixedNodes::THREE_QUARTER_TO_125_LOAD:
+            return fitCoefficients(threeQuarterTo125LoadInverse, ycoord, coeff);
+    }
+    throw std::invalid_argument("CurveFitVal::fixedNodeCoefficients: unknown node set");
+}
+
+double CurveFitVal::fixedNodePolynomial(const FixedNodes nodes, const double *coeff, const double loadFactor) {
+    return nodes == FixedNodes::QUARTER_TO_125_LOAD ? evaluate<5>(coeff, loadFactor) : evaluate<3>(coeff, loadFactor);
+}
+
+double CurveFitVal::fixedNodeFit(const FixedNodes nodes, const double *ycoord, const double loadFactor) {
+    double coeff[5];
+    fixedNodeCoefficients(nodes, ycoord, coeff);
+    return fixedNodePolynomial(nodes, coeff, loadFactor);
+}
+
 std::vector<double> CurveFitVal::Fit_Coefficients() {// Array to store Sigma X values
     std::vector<double> sigmaX(2 * pdegree + 1, 0);
     for (std::size_t i = 0; i < 2 * pdegree + 1; i++) {
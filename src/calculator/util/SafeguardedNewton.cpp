@@ -0,0 +1,49 @@
+/**
+ * @brief Contains the implementation of the SafeguardedNewton root finder.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include "calculator/util/SafeguardedNewton.h"
+
+double SafeguardedNewton::calculate(double low, double high, const double fLow, const double fHigh) const {
+    if (fLow == 0) {
+        return low;
+    }
+    if (fHigh == 0) {
+        return high;
+    }
+    bool const lowPositive = fLow > 0;
+
+    double x = low + fLow * (high - low) / (fLow - fHigh);
+    double step = high - low, previousStep = step;
+    for (int i = 0; i < 100; ++i) {
+        double const f = function(x);
+        if (f == 0) {
+            return x;
+        }
+        if ((f > 0) == lowPositive) {
+            low = x;
+        } else {
+            high = x;
+        }
+        double const df = slope(x);
+        double const newton = df != 0 ? x - f / df : low - 1;
+        if (newton <= low || newton >= high || std::fabs(2 * f) > std::fabs(previousStep * df)) {
+            previousStep = step;
+            step = (high - low) / 2;
+            x = low + step;
+        } else {
+            previousStep = step;
+            step = std::fabs(newton - x);
+            x = newton;
+        }
+        if (step <= tolerance || high - low <= tolerance) {
+            return x;
+        }
+    }
+    throw std::runtime_error("SafeguardedNewton: iteration did not converge");
+}
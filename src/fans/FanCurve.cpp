@@ -1,181 +1,177 @@
 #include <fans/FanCurve.h>
 #include <cmath>
+#include <limits>
 
 std::vector<ResultData> FanCurve::calculate() {
-	if (curveData.calcType == FanCurveData::CalculationType::BaseCurve) {
-		return calculateBaseCurve();
-	} else if (curveData.calcType == FanCurveData::CalculationType::RatedPoint) {
-		return calculateRatedPoint();
-	} else {
-		return calculateBaseOperatingPoint();
+	auto const columns = calculateColumns();
+	std::vector<ResultData> results;
+	results.reserve(columns.flow.size());
+	for (std::size_t i = 0; i < columns.flow.size(); i++) {
+		results.emplace_back(columns.flow[i], columns.pressure[i], columns.power[i], columns.efficiency[i]);
 	}
+	return results;
 }
 
-std::vector<ResultData> FanCurve::calculateBaseCurve() {
-	std::vector<ResultData> results;
-	for (auto const & row : this->curveData.baseCurveData) {
-		double kp = 1, kpC = 1;
-		double estPt, estPtc;
-		for (auto i = 0; i < 7; i++) {
-			auto saveKpOverKpc = kp / kpC;
-			auto const qC = row.flow * (this->speedCorrected / this->speed) * (kp / kpC); // eq 17
+FanCurve::ResultColumns FanCurve::calculateColumns() {
+	auto const terms = rowTerms();
+	return solve(terms, correct(terms, terms.speedCorrected, densityCorrected), pressureBarometricCorrected);
+}
 
-			auto const v1 = row.flow / this->area1; // eq 32, TODO row.flow == Q1? see page 58
-			auto const pv1 = this->density * std::pow(v1 / 1096, 2); // eq 33
-			auto const v2 = row.flow / this->area2;
-			auto const pv2 = this->density * std::pow(v2 / 1096, 2);
-			// if this->area1, this->area2 blank doesn't apply here, but for now the logic will be if they are negative
-			if (this->area1 < 0 || this->area2 < 0) {
-				estPt = row.pressure; // TODO needs further analysis, this might be wrong.
-			} else if (this->curveData.curveType == FanCurveType::FanStaticPressure) {
-				estPt = row.pressure + pv2;
-			} else if (this->curveData.curveType == FanCurveType::StaticPressureRise) {
-				estPt = row.pressure + pv2 - pv1;
-			} else {
-				estPt = row.pressure; // FanCurveType ==  FanTotalPressure
-			}
+FanCurve::RowTerms FanCurve::rowTerms() const {
+	RowTerms terms;
+	auto const addRow = [this, &terms](const double flow, const double pressure, const double power,
+	                                   const double rowDensity, const double rowSpeed, const double rowSpeedCorrected,
+	                                   const double rowPressureBarometric, const bool usePt1Factor, const double rowPt1) {
+		auto const v1 = flow / area1; // eq 32, TODO flow == Q1? see page 58
+		auto const pv1 = rowDensity * std::pow(v1 / 1096, 2); // eq 33
+		auto const v2 = flow / area2;
+		auto const pv2 = rowDensity * std::pow(v2 / 1096, 2);
+		double estPt;
+		// if area1, area2 blank doesn't apply here, but for now the logic will be if they are negative
+		if (area1 < 0 || area2 < 0) {
+			estPt = pressure; // TODO needs further analysis, this might be wrong.
+		} else if (curveData.curveType == FanCurveType::FanStaticPressure) {
+			estPt = pressure + pv2;
+		} else if (curveData.curveType == FanCurveType::StaticPressureRise) {
+			estPt = pressure + pv2 - pv1;
+		} else {
+			estPt = pressure; // FanCurveType ==  FanTotalPressure
+		}
 
-			// eq 18, 19 and 20 depend on the type of FanCurve, here pressure (row.pressure) represents the pressure type?
-			auto const pBoxC = row.pressure * std::pow(this->speedCorrected / this->speed, 2) *
-			                   (this->densityCorrected / this->density) * (kp / kpC);
-			estPtc = estPt * std::pow(this->speedCorrected / this->speed, 2) *
-			         (this->densityCorrected / this->density) * (kp / kpC);
-			auto const hC = row.power * std::pow(this->speedCorrected / this->speed, 3) *
-			                (this->densityCorrected / this->density) * (kp / kpC);
-			auto const pt1 = this->pt1Factor * estPt; // see page 54 section 4.1.13
-			auto const x = estPt / (pt1 + 13.63 * this->pressureBarometric); // eq 25 see pg 54
-			auto const z = ((this->gamma - 1) / this->gamma) * (6362 * row.power / row.flow) /
-			               (pt1 + 13.63 * this->pressureBarometric); // see page 55
-			kp = (std::log(1 + x) / x) * (z / (std::log(1 + z))); // eq 27
-			auto const pt1c = this->pt1Factor * estPtc; // eq 28
-			auto const xc = estPtc / (pt1c + 13.63 * this->pressureBarometricCorrected); // eq 29
-			auto const zc = ((this->gammaCorrected - 1) / this->gammaCorrected) * (6362 * hC / qC) / (pt1c + 13.63 * this->pressureBarometricCorrected); // eq 30
-			kpC = (std::log(1 + xc) / xc) * (zc / (std::log(1 + zc))); // eq 31
-			auto const efficiency = (row.flow * row.pressure * kp) / (6362 * row.power);
+		auto const pt1 = usePt1Factor ? pt1Factor * estPt : rowPt1; // see page 54 section 4.1.13
+		auto const x = estPt / (pt1 + 13.63 * rowPressureBarometric); // eq 25 see pg 54
+		auto const z = ((gamma - 1) / gamma) * (6362 * power / flow) / (pt1 + 13.63 * rowPressureBarometric); // see page 55
+		auto const kp = (std::log(1 + x) / x) * (z / (std::log(1 + z))); // eq 27
 
-			// see page 61 eq 38
-			if (fabs(saveKpOverKpc - kp / kpC) < 0.00001) {
-				results.emplace_back(ResultData(qC, pBoxC, hC, efficiency));
-				break;
-			}
-			if (!row.flow) {
-				results.emplace_back(ResultData(0, pBoxC, hC, 0));
-				break;
-			}
+		terms.flow.push_back(flow);
+		terms.pressure.push_back(pressure);
+		terms.power.push_back(power);
+		terms.density.push_back(rowDensity);
+		terms.speed.push_back(rowSpeed);
+		terms.speedCorrected.push_back(rowSpeedCorrected);
+		terms.estPt.push_back(estPt);
+		terms.kp.push_back(kp);
+		terms.pt1cFactor.push_back(usePt1Factor ? pt1Factor : rowPt1);
+		terms.efficiency.push_back((flow * pressure * kp) / (6362 * power));
+	};
+
+	if (curveData.calcType == FanCurveData::CalculationType::BaseCurve) {
+		for (auto const & row : curveData.baseCurveData) {
+			addRow(row.flow, row.pressure, row.power, density, speed, speedCorrected, pressureBarometric, true, 0);
+		}
+	} else if (curveData.calcType == FanCurveData::CalculationType::RatedPoint) {
+		for (auto const & row : curveData.ratedPointData) {
+			addRow(row.flow, row.pressure, row.power, row.density, row.speed, row.speedCorrected, pressureBarometric,
+			       true, 0);
+		}
+	} else {
+		for (auto const & row : curveData.baseOperatingPointData) {
+			addRow(row.flow, row.pressure, row.power, row.density, row.speed, row.speedCorrected,
+			       row.pressureBarometric, row.usePt1Factor, row.pt1);
 		}
 	}
-	return results;
+	return terms;
 }
 
-std::vector<ResultData> FanCurve::calculateRatedPoint() {
-	std::vector<ResultData> results;
-	for (auto const & row : this->curveData.ratedPointData) {
-		double kp = 1, kpC = 1;
-		double estPt, estPtc;
-		for (auto i = 0; i < 7; i++) {
-			auto saveKpOverKpc = kp / kpC;
-			auto const qC = row.flow * (row.speedCorrected / row.speed) * (kp / kpC); // eq 17
-
-			auto const v1 = row.flow / this->area1; // eq 32, TODO row.flow == Q1? see page 58
-			auto const pv1 = row.density * std::pow(v1 / 1096, 2); // eq 33
-			auto const v2 = row.flow / this->area2;
-			auto const pv2 = row.density * std::pow(v2 / 1096, 2);
-			// if this->area1, this->area2 blank doesn't apply here, but for now the logic will be if they are negative
-			if (this->area1 < 0 || this->area2 < 0) {
-				estPt = row.pressure; // TODO needs further analysis, this might be wrong.
-			} else if (this->curveData.curveType == FanCurveType::FanStaticPressure) {
-				estPt = row.pressure + pv2;
-			} else if (this->curveData.curveType == FanCurveType::StaticPressureRise) {
-				estPt = row.pressure + pv2 - pv1;
-			} else {
-				estPt = row.pressure; // FanCurveType ==  FanTotalPressure
-			}
-
-			// eq 18, 19 and 20 depend on the type of FanCurve, here pressure (row.pressure) represents the pressure type?
-			auto const pBoxC = row.pressure * std::pow(row.speedCorrected / row.speed, 2) *
-			                   (this->densityCorrected / row.density) * (kp / kpC);
-			estPtc = estPt * std::pow(row.speedCorrected / row.speed, 2) *
-			         (this->densityCorrected / row.density) * (kp / kpC);
-			auto const hC = row.power * std::pow(row.speedCorrected / row.speed, 3) *
-			                (this->densityCorrected / row.density) * (kp / kpC);
-			auto const pt1 = this->pt1Factor * estPt; // see page 54 section 4.1.13
-			auto const x = estPt / (pt1 + 13.63 * this->pressureBarometric); // eq 25 see pg 54
-			auto const z = ((this->gamma - 1) / this->gamma) * (6362 * row.power / row.flow) /
-			               (pt1 + 13.63 * this->pressureBarometric); // see page 55
-			kp = (std::log(1 + x) / x) * (z / (std::log(1 + z))); // eq 27
-			auto const pt1c = this->pt1Factor * estPtc; // eq 28
-			auto const xc = estPtc / (pt1c + 13.63 * this->pressureBarometricCorrected); // eq 29
-			auto const zc = ((this->gammaCorrected - 1) / this->gammaCorrected) * (6362 * hC / qC) / (pt1c + 13.63 * this->pressureBarometricCorrected); // eq 30
-			kpC = (std::log(1 + xc) / xc) * (zc / (std::log(1 + zc))); // eq 31
-			auto const efficiency = (row.flow * row.pressure * kp) / (6362 * row.power);
+FanCurve::CorrectedTerms FanCurve::correct(const RowTerms &terms, const std::vector<double> &speedsCorrected,
+                                           const double densityCorrected) const {
+	std::size_t const rows = terms.flow.size();
+	CorrectedTerms corrected;
+	corrected.flowC.resize(rows);
+	corrected.pressureC.resize(rows);
+	corrected.estPtC.resize(rows);
+	corrected.powerC.resize(rows);
 
-			// see page 61 eq 38
-			if (fabs(saveKpOverKpc - kp / kpC) < 0.00001) {
-				results.emplace_back(ResultData(qC, pBoxC, hC, efficiency));
-				break;
-			}
-			if (!row.flow) {
-				results.emplace_back(ResultData(0, pBoxC, hC, 0));
-				break;
-			}
+	// speed and density ratios of the last row, most curves use the same for all rows
+	double lastSpeed = std::numeric_limits<double>::quiet_NaN(), lastSpeedCorrected = lastSpeed, lastDensity = lastSpeed;
+	double speedRatio = 0, speedRatio2 = 0, speedRatio3 = 0, densityRatio = 0;
+	for (std::size_t i = 0; i < rows; i++) {
+		if (terms.speed[i] != lastSpeed || speedsCorrected[i] != lastSpeedCorrected || terms.density[i] != lastDensity) {
+			lastSpeed = terms.speed[i];
+			lastSpeedCorrected = speedsCorrected[i];
+			lastDensity = terms.density[i];
+			speedRatio = lastSpeedCorrected / lastSpeed;
+			speedRatio2 = std::pow(speedRatio, 2);
+			speedRatio3 = std::pow(speedRatio, 3);
+			densityRatio = densityCorrected / lastDensity;
 		}
+		// eq 18, 19 and 20 depend on the type of FanCurve
+		corrected.flowC[i] = terms.flow[i] * speedRatio;
+		corrected.pressureC[i] = terms.pressure[i] * speedRatio2 * densityRatio;
+		corrected.estPtC[i] = terms.estPt[i] * speedRatio2 * densityRatio;
+		corrected.powerC[i] = terms.power[i] * speedRatio3 * densityRatio;
 	}
-	return results;
+	return corrected;
 }
 
-std::vector<ResultData> FanCurve::calculateBaseOperatingPoint() {
-	std::vector<ResultData> results;
+FanCurve::ResultColumns FanCurve::solve(const RowTerms &terms, const CorrectedTerms &corrected,
+                                        const double pressureBarometricCorrected) const {
+	std::size_t const rows = terms.flow.size();
+	ResultColumns results;
+	results.flow.resize(rows);
+	results.pressure.resize(rows);
+	results.power.resize(rows);
+	results.efficiency.resize(rows);
 
-	for (auto const & row : this->curveData.baseOperatingPointData) {
-		double kp = 1, kpC = 1;
-		double estPt, estPtc;
-		for (auto i = 0; i < 7; i++) {
-			auto saveKpOverKpc = kp / kpC;
-			auto const qC = row.flow * (row.speedCorrected / row.speed) * (kp / kpC); // eq 17
-
-			auto const v1 = row.flow / this->area1; // eq 32, TODO row.flow == Q1? see page 58
-			auto const pv1 = row.density * std::pow(v1 / 1096, 2); // eq 33
-			auto const v2 = row.flow / this->area2;
-			auto const pv2 = row.density * std::pow(v2 / 1096, 2);
-			// if this->area1, this->area2 blank doesn't apply here, but for now the logic will be if they are negative
-			if (this->area1 < 0 || this->area2 < 0) {
-				estPt = row.pressure; // TODO needs further analysis, this might be wrong.
-			} else if (this->curveData.curveType == FanCurveType::FanStaticPressure) {
-				estPt = row.pressure + pv2;
-			} else if (this->curveData.curveType == FanCurveType::StaticPressureRise) {
-				estPt = row.pressure + pv2 - pv1;
-			} else {
-				estPt = row.pressure; // FanCurveType ==  FanTotalPressure
-			}
+	// kp / kpC of each row, and the rows still iterating in row order
+	std::vector<double> kpOverKpc(rows, 1);
+	std::vector<std::size_t> active(rows);
+	std::vector<bool> converged(rows, false);
+	for (std::size_t i = 0; i < rows; i++) {
+		active[i] = i;
+	}
 
-			// eq 18, 19 and 20 depend on the type of FanCurve, here pressure (row.pressure) represents the pressure type?
-			auto const pBoxC = row.pressure * std::pow(row.speedCorrected / row.speed, 2) *
-			                   (this->densityCorrected / row.density) * (kp / kpC);
-			estPtc = estPt * std::pow(row.speedCorrected / row.speed, 2) *
-			         (this->densityCorrected / row.density) * (kp / kpC);
-			auto const hC = row.power * std::pow(row.speedCorrected / row.speed, 3) *
-			                (this->densityCorrected / row.density) * (kp / kpC);
-			auto const pt1 = (row.usePt1Factor) ? this->pt1Factor * estPt : row.pt1; // see page 54 section 4.1.13
-			auto const x = estPt / (pt1 + 13.63 * row.pressureBarometric); // eq 25 see pg 54
-			auto const z = ((this->gamma - 1) / this->gamma) * (6362 * row.power / row.flow) /
-			               (pt1 + 13.63 * row.pressureBarometric); // see page 55
-			kp = (std::log(1 + x) / x) * (z / (std::log(1 + z))); // eq 27
-			auto const pt1c = (row.usePt1Factor) ? this->pt1Factor * estPtc : row.pt1 * estPtc; // eq 28
-			auto const xc = estPtc / (pt1c + 13.63 * this->pressureBarometricCorrected); // eq 29
-			auto const zc = ((this->gammaCorrected - 1) / this->gammaCorrected) * (6362 * hC / qC) / (pt1c + 13.63 * this->pressureBarometricCorrected); // eq 30
-			kpC = (std::log(1 + xc) / xc) * (zc / (std::log(1 + zc))); // eq 31
-			auto const efficiency = (row.flow * row.pressure * kp) / (6362 * row.power);
+	double const gammaTerm = (gammaCorrected - 1) / gammaCorrected;
+	double const pressureTerm = 13.63 * pressureBarometricCorrected;
+	for (auto iteration = 0; iteration < 7 && !active.empty(); iteration++) {
+		std::size_t stillActive = 0;
+		for (auto const i : active) {
+			auto const ratio = kpOverKpc[i];
+			auto const qC = corrected.flowC[i] * ratio; // eq 17
+			auto const pBoxC = corrected.pressureC[i] * ratio;
+			auto const estPtc = corrected.estPtC[i] * ratio;
+			auto const hC = corrected.powerC[i] * ratio;
+			auto const pt1c = terms.pt1cFactor[i] * estPtc; // eq 28
+			auto const xc = estPtc / (pt1c + pressureTerm); // eq 29
+			auto const zc = gammaTerm * (6362 * hC / qC) / (pt1c + pressureTerm); // eq 30
+			auto const kpC = (std::log(1 + xc) / xc) * (zc / (std::log(1 + zc))); // eq 31
+			auto const next = terms.kp[i] / kpC;
 
 			// see page 61 eq 38
-			if (fabs(saveKpOverKpc - kp / kpC) < 0.00001) {
-				results.emplace_back(ResultData(qC, pBoxC, hC, efficiency));
-				break;
-			}
-			if (!row.flow) {
-				results.emplace_back(ResultData(0, pBoxC, hC, 0));
-				break;
+			if (std::fabs(ratio - next) < 0.00001) {
+				results.flow[i] = qC;
+				results.pressure[i] = pBoxC;
+				results.power[i] = hC;
+				results.efficiency[i] = terms.efficiency[i];
+				converged[i] = true;
+			} else if (!terms.flow[i]) {
+				results.flow[i] = 0;
+				results.pressure[i] = pBoxC;
+				results.power[i] = hC;
+				results.efficiency[i] = 0;
+				converged[i] = true;
+			} else {
+				kpOverKpc[i] = next;
+				active[stillActive++] = i;
 			}
 		}
+		active.resize(stillActive);
+	}
+
+	// rows that did not converge are left out
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < rows; i++) {
+		if (converged[i]) {
+			results.flow[kept] = results.flow[i];
+			results.pressure[kept] = results.pressure[i];
+			results.power[kept] = results.power[i];
+			results.efficiency[kept] = results.efficiency[i];
+			kept++;
+		}
 	}
+	results.flow.resize(kept);
+	results.pressure.resize(kept);
+	results.power.resize(kept);
+	results.efficiency.resize(kept);
 	return results;
 }
@@ -0,0 +1,21 @@
+#include <fans/FanCurveFamily.h>
+#include <utility>
+
+FanCurveFamily::FanCurveFamily(FanCurve curve)
+		: curve(std::move(curve)), terms(this->curve.rowTerms())
+{}
+
+FanCurve::ResultColumns FanCurveFamily::calculate(const Correction &correction) const {
+	std::vector<double> const speedsCorrected(terms.flow.size(), correction.speedCorrected);
+	return curve.solve(terms, curve.correct(terms, speedsCorrected, correction.densityCorrected),
+	                   correction.pressureBarometricCorrected);
+}
+
+std::vector<FanCurve::ResultColumns> FanCurveFamily::calculate(const std::vector<Correction> &corrections) const {
+	std::vector<FanCurve::ResultColumns> curves;
+	curves.reserve(corrections.size());
+	for (auto const & correction : corrections) {
+		curves.push_back(calculate(correction));
+	}
+	return curves;
+}
@@ -0,0 +1,156 @@
+#include <fans/FanSystemEnergyModel.h>
+#include <fans/FanShaftPower.h>
+#include <fans/FanEnergyIndex.h>
+#include <calculator/util/SafeguardedNewton.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+	/// DOE-2 inlet vane part load curve, 0.98983 rather than 1 at the design flow rate
+	double inletVaneCurve(const double flowFraction) {
+		return 0.35071223 + flowFraction * (0.30850535 + flowFraction * (-0.54137364 + flowFraction * 0.87198823));
+	}
+
+	/// fraction of the design fan shaft power at a fraction of the design flow rate, the DOE-2 inlet vane curve scaled
+	/// so that fully open vanes draw the power of the fan curve
+	double inletVanePowerFraction(const double flowFraction) {
+		return inletVaneCurve(flowFraction) / inletVaneCurve(1);
+	}
+}
+
+FanSystemEnergyModel::FanSystemEnergyModel(FanCurve fanCurve, const OptimalFanEfficiency::FanType fanType,
+                                           const double designFlowRate, const double systemStaticPressure,
+                                           const double motorEfficiency, const double beltEfficiency,
+                                           const double vfdEfficiency)
+		: curve(fanCurve.calculateColumns()), density(fanCurve.densityCorrected), speed(fanCurve.speedCorrected),
+		  designFlowRate(designFlowRate), systemStaticPressure(systemStaticPressure) {
+	if (curve.flow.size() < 2) {
+		throw std::runtime_error("FanSystemEnergyModel: the corrected fan curve needs at least 2 rows");
+	}
+	for (std::size_t i = 1; i < curve.flow.size(); i++) {
+		if (curve.flow[i] <= curve.flow[i - 1]) {
+			throw std::runtime_error("FanSystemEnergyModel: the flow rates of the fan curve must be increasing");
+		}
+	}
+	if (designFlowRate <= 0) {
+		throw std::runtime_error("FanSystemEnergyModel: the design flow rate must be positive");
+	}
+
+	double const designPressure = interpolate(curve.pressure, designFlowRate);
+	if (designPressure <= systemStaticPressure) {
+		throw std::runtime_error("FanSystemEnergyModel: the fan pressure at the design flow rate must be above the system static pressure");
+	}
+	lossCoefficient = (designPressure - systemStaticPressure) / (designFlowRate * designFlowRate);
+	designPower = interpolate(curve.power, designFlowRate);
+	designFanEfficiency = interpolate(curve.efficiency, designFlowRate);
+	optimalFanEfficiency = OptimalFanEfficiency(fanType, speed, designFlowRate, 0, designPressure, 1).calculate();
+
+	// FanShaftPower takes the efficiencies as %, its fan power input per unit of motor power is the drive train efficiency
+	driveTrainEfficiency = FanShaftPower(1, motorEfficiency, 100, beltEfficiency, 0).getFanPowerInput();
+	driveTrainEfficiencyVFD = FanShaftPower(1, motorEfficiency, vfdEfficiency, beltEfficiency, 0).getFanPowerInput();
+}
+
+std::size_t FanSystemEnergyModel::segment(const double flowRate) const {
+	auto const upper = std::upper_bound(curve.flow.begin() + 1, curve.flow.end() - 1, flowRate);
+	return upper - curve.flow.begin() - 1;
+}
+
+double FanSystemEnergyModel::interpolate(const std::vector<double> &column, const double flowRate) const {
+	std::size_t const i = segment(flowRate);
+	return column[i] + (column[i + 1] - column[i]) * (flowRate - curve.flow[i]) / (curve.flow[i + 1] - curve.flow[i]);
+}
+
+double FanSystemEnergyModel::pressureSlope(const double flowRate) const {
+	std::size_t const i = segment(flowRate);
+	return (curve.pressure[i + 1] - curve.pressure[i]) / (curve.flow[i + 1] - curve.flow[i]);
+}
+
+double FanSystemEnergyModel::systemPressure(const double flowRate) const {
+	return systemStaticPressure + lossCoefficient * flowRate * flowRate;
+}
+
+double FanSystemEnergyModel::speedRatio(const double flowRate) const {
+	double const target = systemPressure(flowRate);
+	// fan pressure at speed ratio r, r^2 * P(flowRate / r), less the system pressure; rises with r
+	auto const excess = [&](double r) {
+		return r * r * interpolate(curve.pressure, flowRate / r) - target;
+	};
+	auto const slope = [&](double r) {
+		return 2 * r * interpolate(curve.pressure, flowRate / r) - flowRate * pressureSlope(flowRate / r);
+	};
+
+	double const low = flowRate / curve.flow.back();
+	double const fLow = excess(low), fHigh = excess(1);
+	if (fHigh <= 0) { // the design point, where the fan runs at full speed
+		return 1;
+	}
+	if (fLow > 0) {
+		throw std::runtime_error("FanSystemEnergyModel: the system curve does not meet the scaled fan curve within its flow range");
+	}
+	return SafeguardedNewton(excess, slope, 1e-12).calculate(low, 1, fLow, fHigh);
+}
+
+FanSystemEnergyModel::Output FanSystemEnergyModel::calculate(const Control control,
+                                                             const std::vector<Bin> &profile) const {
+	std::size_t const bins = profile.size();
+	Output output;
+	output.speedRatio.resize(bins, 1);
+	output.pressure.resize(bins);
+	output.fanShaftPower.resize(bins);
+	output.fanEfficiency.resize(bins);
+	output.motorPower.resize(bins);
+	output.energy.resize(bins);
+	output.fanEnergyIndex.resize(bins);
+	output.hours = 0;
+	output.annualEnergy = 0;
+
+	double const efficiency = control == Control::VFD ? driveTrainEfficiencyVFD : driveTrainEfficiency;
+	for (std::size_t i = 0; i < bins; i++) {
+		double const flowRate = profile[i].flowRate;
+		output.hours += profile[i].hours;
+		if (flowRate < 0 || flowRate > designFlowRate) {
+			throw std::runtime_error("FanSystemEnergyModel: flow rates must be from 0 to the design flow rate");
+		}
+		if (flowRate == 0) {
+			output.speedRatio[i] = 0;
+			continue;
+		}
+
+		double pressure, power;
+		if (control == Control::OutletDamper) {
+			pressure = interpolate(curve.pressure, flowRate);
+			power = interpolate(curve.power, flowRate);
+			output.fanEfficiency[i] = interpolate(curve.efficiency, flowRate);
+		} else if (control == Control::InletVanes) {
+			pressure = systemPressure(flowRate);
+			power = designPower * inletVanePowerFraction(flowRate / designFlowRate);
+			output.fanEfficiency[i] = designFanEfficiency * (flowRate * pressure / power)
+			                          / (designFlowRate * systemPressure(designFlowRate) / designPower);
+		} else {
+			double const r = speedRatio(flowRate);
+			pressure = systemPressure(flowRate);
+			power = r * r * r * interpolate(curve.power, flowRate / r);
+			output.speedRatio[i] = r;
+			output.fanEfficiency[i] = interpolate(curve.efficiency, flowRate / r);
+		}
+
+		output.pressure[i] = pressure;
+		output.fanShaftPower[i] = power;
+		output.motorPower[i] = power * 0.7457 / efficiency;
+		output.energy[i] = output.motorPower[i] * profile[i].hours;
+		output.fanEnergyIndex[i] = FanEnergyIndex(flowRate, 0, pressure, density, output.motorPower[i])
+				.calculateEnergyIndex();
+		output.annualEnergy += output.energy[i];
+	}
+	return output;
+}
+
+FanSystemEnergyModel::Output FanSystemEnergyModel::calculate(const Control control,
+                                                             const std::vector<double> &hourlyFlowRates) const {
+	std::vector<Bin> profile;
+	profile.reserve(hourlyFlowRates.size());
+	for (auto const flowRate : hourlyFlowRates) {
+		profile.push_back({flowRate, 1});
+	}
+	return calculate(control, profile);
+}
@@ -0,0 +1,176 @@
+#include <fans/Psychrometrics.h>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+	// water over air molecular weight ratio
+	double const nMol = 0.62198;
+
+	// Hyland and Wexler saturation pressure over ice (C1 - C7) and over water (C8 - C13), in Pa of the temperature in K
+	double const C1 = -5674.5359;
+	double const C2 = 6.3925247;
+	double const C3 = -0.009677843;
+	double const C4 = 0.00000062215701;
+	double const C5 = 2.0747825 * std::pow(10, -9);
+	double const C6 = -9.484024 * std::pow(10, -13);
+	double const C7 = 4.1635019;
+	double const C8 = -5800.2206;
+	double const C9 = 1.3914993;
+	double const C10 = -0.048640239;
+	double const C11 = 0.000041764768;
+	double const C12 = -0.000000014452093;
+	double const C13 = 6.5459673;
+
+	double kelvin(const double temperature) {
+		return (temperature + 459.67) * 0.555556;
+	}
+
+	void checkSizes(const std::vector<double> &temperatures, const std::vector<double> &humidities) {
+		if (temperatures.size() != humidities.size()) {
+			throw std::runtime_error("Psychrometrics: every dry bulb temperature needs a humidity");
+		}
+	}
+}
+
+double Psychrometrics::saturationPressure(const double temperature) {
+	double const tKelvin = kelvin(temperature);
+
+	if (tKelvin < 273.15) {
+		double const p = std::exp(C1 / tKelvin + C2 + tKelvin * C3 + tKelvin * tKelvin * (C4 + tKelvin * (C5 + C6 * tKelvin)) + C7 * std::log(tKelvin));
+		return p * (29.9216 / 101325);
+	}
+	double const p = std::exp(C8 / tKelvin + C9 + tKelvin * (C10 + tKelvin * (C11 + tKelvin * C12)) + C13 * std::log(tKelvin));
+
+	return p * (29.9216 / 101325);
+}
+
+double Psychrometrics::saturationPressureDerivative(const double temperature) {
+	double const tKelvin = kelvin(temperature);
+
+	// d ln(p) / d tKelvin
+	double dLogP;
+	if (tKelvin < 273.15) {
+		dLogP = -C1 / (tKelvin * tKelvin) + C3 + tKelvin * (2 * C4 + tKelvin * (3 * C5 + 4 * C6 * tKelvin)) + C7 / tKelvin;
+	} else {
+		dLogP = -C8 / (tKelvin * tKelvin) + C10 + tKelvin * (2 * C11 + 3 * C12 * tKelvin) + C13 / tKelvin;
+	}
+	return saturationPressure(temperature) * dLogP * 0.555556;
+}
+
+double Psychrometrics::humidityRatio(const double dryBulbTemp, const double relativeHumidity,
+                                     const double absolutePressure, const double specificGravity) {
+	auto const pw = (saturationPressure(dryBulbTemp) * relativeHumidity);
+	return (18.02 / (specificGravity * 28.98)) * pw / (absolutePressure - pw);
+}
+
+double Psychrometrics::humidityRatioFromWetBulb(const double dryBulbTemp, const double wetBulbTemp,
+                                                const double absolutePressure, const double cpGas) {
+	double const psatWb = saturationPressure(wetBulbTemp);
+	double const wStar = nMol * psatWb / (absolutePressure - psatWb);
+	return ((1093 - (1 - 0.444) * wetBulbTemp) * wStar - cpGas * (dryBulbTemp - wetBulbTemp)) / (1093 + (0.444 * dryBulbTemp) - wetBulbTemp);
+}
+
+double Psychrometrics::humidityRatioFromWetBulbDerivative(const double dryBulbTemp, const double wetBulbTemp,
+                                                          const double absolutePressure, const double cpGas) {
+	double const psatWb = saturationPressure(wetBulbTemp);
+	double const dPsatWb = saturationPressureDerivative(wetBulbTemp);
+	double const wStar = nMol * psatWb / (absolutePressure - psatWb);
+	double const dWStar = nMol * absolutePressure * dPsatWb / std::pow(absolutePressure - psatWb, 2);
+
+	// w = numerator / denominator, the denominator falling 1 per °F of wet bulb temperature
+	double const numerator = (1093 - (1 - 0.444) * wetBulbTemp) * wStar - cpGas * (dryBulbTemp - wetBulbTemp);
+	double const denominator = 1093 + (0.444 * dryBulbTemp) - wetBulbTemp;
+	double const dNumerator = -(1 - 0.444) * wStar + (1093 - (1 - 0.444) * wetBulbTemp) * dWStar + cpGas;
+	return (dNumerator + numerator / denominator) / denominator;
+}
+
+double Psychrometrics::relativeHumidityFromWetBulb(const double dryBulbTemp, const double wetBulbTemp,
+                                                   const double absolutePressure, const double cpGas) {
+	double const w = humidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp, absolutePressure, cpGas);
+	double const pV = absolutePressure * w / (nMol + w);
+	return pV / saturationPressure(dryBulbTemp);
+}
+
+double Psychrometrics::wetBulbTemperature(const double dryBulbTemp, const double relativeHumidity,
+                                          const double absolutePressure, const double cpGas) {
+	double const target = humidityRatio(dryBulbTemp, relativeHumidity, absolutePressure, 1);
+	auto const converged = [target](const double w) {
+		return (target > 0) ? std::fabs((w - target) / target) <= 0.00001 : std::fabs(w - target) <= 0.00001;
+	};
+
+	// the humidity ratio rises with the wet bulb temperature; near absolute zero there is no vapor and it is negative,
+	// at the dry bulb temperature it is that of saturated air
+	double below = -459.0, above = dryBulbTemp;
+	double wetBulbTemp = dryBulbTemp;
+	double w = humidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp, absolutePressure, cpGas);
+	if (w < target) { // supersaturated
+		below = dryBulbTemp;
+		above = dryBulbTemp + 100;
+	}
+
+	for (auto i = 0; i < 100; i++) {
+		if (converged(w)) return wetBulbTemp;
+		if (w < target) {
+			below = wetBulbTemp;
+		} else {
+			above = wetBulbTemp;
+		}
+
+		double next = wetBulbTemp - (w - target) / humidityRatioFromWetBulbDerivative(dryBulbTemp, wetBulbTemp,
+		                                                                              absolutePressure, cpGas);
+		if (!(next > below && next < above)) next = (below + above) / 2;
+		wetBulbTemp = next;
+		w = humidityRatioFromWetBulb(dryBulbTemp, wetBulbTemp, absolutePressure, cpGas);
+	}
+	throw std::runtime_error("Psychrometrics::wetBulbTemperature - wet bulb iteration did not converge");
+}
+
+double Psychrometrics::dewPoint(const double dryBulbTemp, const double humidityRatio, const double absolutePressure) {
+	double const alpha = std::log(absolutePressure * 0.4911541 * humidityRatio / (nMol + humidityRatio));
+
+	if (dryBulbTemp < 32) {
+		return 90.12 + 26.412 * alpha + 0.8927 * alpha * alpha;
+	}
+	return 100.45 + 33.193 * alpha + 2.319 * alpha * alpha + 0.17074 * alpha * alpha * alpha + 1.2063 * (std::pow((absolutePressure * 0.4911541 * humidityRatio / (0.62196 + humidityRatio)), 0.1984));
+}
+
+std::vector<double> Psychrometrics::saturationPressure(const std::vector<double> &temperatures) {
+	std::vector<double> pressures(temperatures.size());
+	for (std::size_t i = 0; i < temperatures.size(); i++) {
+		pressures[i] = saturationPressure(temperatures[i]);
+	}
+	return pressures;
+}
+
+std::vector<double> Psychrometrics::humidityRatio(const std::vector<double> &dryBulbTemps,
+                                                  const std::vector<double> &relativeHumidities,
+                                                  const double absolutePressure, const double specificGravity) {
+	checkSizes(dryBulbTemps, relativeHumidities);
+	std::vector<double> ratios(dryBulbTemps.size());
+	for (std::size_t i = 0; i < dryBulbTemps.size(); i++) {
+		ratios[i] = humidityRatio(dryBulbTemps[i], relativeHumidities[i], absolutePressure, specificGravity);
+	}
+	return ratios;
+}
+
+std::vector<double> Psychrometrics::wetBulbTemperature(const std::vector<double> &dryBulbTemps,
+                                                       const std::vector<double> &relativeHumidities,
+                                                       const double absolutePressure, const double cpGas) {
+	checkSizes(dryBulbTemps, relativeHumidities);
+	std::vector<double> temperatures(dryBulbTemps.size());
+	for (std::size_t i = 0; i < dryBulbTemps.size(); i++) {
+		temperatures[i] = wetBulbTemperature(dryBulbTemps[i], relativeHumidities[i], absolutePressure, cpGas);
+	}
+	return temperatures;
+}
+
+std::vector<double> Psychrometrics::dewPoint(const std::vector<double> &dryBulbTemps,
+                                             const std::vector<double> &humidityRatios,
+                                             const double absolutePressure) {
+	checkSizes(dryBulbTemps, humidityRatios);
+	std::vector<double> dewPoints(dryBulbTemps.size());
+	for (std::size_t i = 0; i < dryBulbTemps.size(); i++) {
+		dewPoints[i] = dewPoint(dryBulbTemps[i], humidityRatios[i], absolutePressure);
+	}
+	return dewPoints;
+}
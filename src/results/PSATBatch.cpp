@@ -0,0 +1,167 @@
+/**
+ * @file
+ * @brief Contains the definition of functions of the PSATBatch class.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include "results/PSATBatch.h"
+#include "results/Results.h"
+#include "calculator/motor/MotorCurveSet.h"
+
+void PSATBatch::Input::add(const Pump::Input &pump, const Motor &motor, const Pump::FieldData &fieldData,
+                           const double operatingHours, const double unitCost) {
+    style.push_back(pump.style);
+    pumpEfficiency.push_back(pump.pumpEfficiency);
+    pumpRpm.push_back(pump.rpm);
+    drive.push_back(pump.drive);
+    kinematicViscosity.push_back(pump.kviscosity);
+    specificGravity.push_back(pump.specificGravity);
+    stageCount.push_back(pump.stageCount);
+    fixedSpeed.push_back(pump.speed);
+    driveEfficiency.push_back(pump.specifiedEfficiency);
+
+    lineFrequency.push_back(motor.lineFrequency);
+    motorRatedPower.push_back(motor.motorRatedPower);
+    motorRpm.push_back(motor.motorRpm);
+    efficiencyClass.push_back(motor.efficiencyClass);
+    motorSpecifiedEfficiency.push_back(motor.specifiedEfficiency);
+    motorRatedVoltage.push_back(motor.motorRatedVoltage);
+    fullLoadAmps.push_back(motor.fullLoadAmps);
+
+    flowRate.push_back(fieldData.flowRate);
+    head.push_back(fieldData.head);
+    loadEstimationMethod.push_back(fieldData.loadEstimationMethod);
+    motorPower.push_back(fieldData.motorPower);
+    motorAmps.push_back(fieldData.motorAmps);
+    voltage.push_back(fieldData.voltage);
+
+    this->operatingHours.push_back(operatingHours);
+    this->unitCost.push_back(unitCost);
+}
+
+void PSATBatch::Input::reserve(const std::size_t count) {
+    style.reserve(count);
+    pumpEfficiency.reserve(count);
+    pumpRpm.reserve(count);
+    drive.reserve(count);
+    kinematicViscosity.reserve(count);
+    specificGravity.reserve(count);
+    stageCount.reserve(count);
+    fixedSpeed.reserve(count);
+    driveEfficiency.reserve(count);
+    lineFrequency.reserve(count);
+    motorRatedPower.reserve(count);
+    motorRpm.reserve(count);
+    efficiencyClass.reserve(count);
+    motorSpecifiedEfficiency.reserve(count);
+    motorRatedVoltage.reserve(count);
+    fullLoadAmps.reserve(count);
+    flowRate.reserve(count);
+    head.reserve(count);
+    loadEstimationMethod.reserve(count);
+    motorPower.reserve(count);
+    motorAmps.reserve(count);
+    voltage.reserve(count);
+    operatingHours.reserve(count);
+    unitCost.reserve(count);
+}
+
+std::size_t PSATBatch::Input::size() const {
+    std::size_t const count = style.size();
+    std::size_t const sizes[] = {
+            pumpEfficiency.size(), pumpRpm.size(), drive.size(), kinematicViscosity.size(), specificGravity.size(),
+            stageCount.size(), fixedSpeed.size(), driveEfficiency.size(), lineFrequency.size(),
+            motorRatedPower.size(), motorRpm.size(), efficiencyClass.size(), motorSpecifiedEfficiency.size(),
+            motorRatedVoltage.size(), fullLoadAmps.size(), flowRate.size(), head.size(),
+            loadEstimationMethod.size(), motorPower.size(), motorAmps.size(), voltage.size(), operatingHours.size(),
+            unitCost.size()
+    };
+    for (auto const columnSize : sizes) {
+        if (columnSize != count) {
+            throw std::runtime_error("PSATBatch::Input: all columns must have one entry per pump");
+        }
+    }
+    return count;
+}
+
+void PSATBatch::Output::resize(const std::size_t count) {
+    for (auto column : {&pumpEfficiency, &motorRatedPower, &motorShaftPower, &pumpShaftPower, &motorEfficiency,
+                        &motorPowerFactor, &motorCurrent, &motorPower, &annualEnergy, &annualCost, &loadFactor,
+                        &driveEfficiency, &estimatedFLA}) {
+        column->resize(count);
+    }
+}
+
+void PSATBatch::Output::set(const std::size_t i, const double pumpEfficiency, const double motorRatedPower,
+                            const double motorShaftPower, const double pumpShaftPower, const double motorEfficiency,
+                            const double motorPowerFactor, const double motorCurrent, const double motorPower,
+                            const double annualEnergy, const double annualCost, const double loadFactor,
+                            const double driveEfficiency, const double estimatedFLA) {
+    this->pumpEfficiency[i] = pumpEfficiency;
+    this->motorRatedPower[i] = motorRatedPower;
+    this->motorShaftPower[i] = motorShaftPower;
+    this->pumpShaftPower[i] = pumpShaftPower;
+    this->motorEfficiency[i] = motorEfficiency;
+    this->motorPowerFactor[i] = motorPowerFactor;
+    this->motorCurrent[i] = motorCurrent;
+    this->motorPower[i] = motorPower;
+    this->annualEnergy[i] = annualEnergy;
+    this->annualCost[i] = annualCost;
+    this->loadFactor[i] = loadFactor;
+    this->driveEfficiency[i] = driveEfficiency;
+    this->estimatedFLA[i] = estimatedFLA;
+}
+
+PSATBatch::Result PSATBatch::calculate(const Input &input) const {
+    std::size_t const count = input.size();
+
+    /// Group the pumps by motor, keyed on the MotorCurveSet constructor arguments
+    typedef std::tuple<Motor::LineFrequency, double, Motor::EfficiencyClass, double, double, double, double> MotorKey;
+    std::map<MotorKey, std::size_t> groups;
+    std::vector<MotorCurveSet> curves;
+    std::vector<std::size_t> groupOf(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        MotorKey const key(input.lineFrequency[i], input.motorRpm[i], input.efficiencyClass[i],
+                           input.motorRatedPower[i], input.motorSpecifiedEfficiency[i], input.motorRatedVoltage[i],
+                           input.fullLoadAmps[i]);
+        auto const group = groups.insert(std::make_pair(key, curves.size()));
+        if (group.second) {
+            curves.emplace_back(input.lineFrequency[i], input.motorRpm[i], input.efficiencyClass[i],
+                                input.motorRatedPower[i], input.motorSpecifiedEfficiency[i],
+                                input.motorRatedVoltage[i], input.fullLoadAmps[i]);
+        }
+        groupOf[i] = group.first->second;
+    }
+
+    Result result;
+    result.motorGroupCount = curves.size();
+    result.existing.resize(count);
+    result.modified.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        Pump::Input const pump(input.style[i], input.pumpEfficiency[i], input.pumpRpm[i], input.drive[i],
+                               input.kinematicViscosity[i], input.specificGravity[i], input.stageCount[i],
+                               input.fixedSpeed[i], input.driveEfficiency[i]);
+        Pump::FieldData const fieldData(input.flowRate[i], input.head[i], input.loadEstimationMethod[i],
+                                        input.motorPower[i], input.motorAmps[i], input.voltage[i]);
+        MotorCurveSet const & motorCurves = curves[groupOf[i]];
+
+        auto const ex = PSATResult::existingFromCurves(motorCurves, pump, fieldData, input.operatingHours[i],
+                                                       input.unitCost[i], loadSolver);
+        result.existing.set(i, ex.pumpEfficiency, ex.motorRatedPower, ex.motorShaftPower, ex.pumpShaftPower,
+                            ex.motorEfficiency, ex.motorPowerFactor, ex.motorCurrent, ex.motorPower, ex.annualEnergy,
+                            ex.annualCost, ex.loadFactor, ex.driveEfficiency, ex.estimatedFLA);
+
+        auto const mod = PSATResult::modifiedFromCurves(motorCurves, pump, fieldData, input.operatingHours[i],
+                                                        input.unitCost[i], loadSolver);
+        result.modified.set(i, mod.pumpEfficiency, mod.motorRatedPower, mod.motorShaftPower, mod.pumpShaftPower,
+                            mod.motorEfficiency, mod.motorPowerFactor, mod.motorCurrent, mod.motorPower,
+                            mod.annualEnergy, mod.annualCost, mod.loadFactor, mod.driveEfficiency, mod.estimatedFLA);
+    }
+    return result;
+}
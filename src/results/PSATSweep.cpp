@@ -0,0 +1,79 @@
+/**
+ * @file
+ * @brief Contains the definition of functions of the PSATSweep class.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <stdexcept>
+#include "results/PSATSweep.h"
+#include "calculator/pump/MoverEfficiency.h"
+
+PSATSweep::PSATSweep(const Pump::Input &pumpInput, const Motor &motor, const double fieldVoltage,
+                     const double operatingHours, const double unitCost, const Motor::LoadSolver loadSolver)
+        : pumpInput(pumpInput),
+          curves(motor.lineFrequency, motor.motorRpm, motor.efficiencyClass, motor.motorRatedPower,
+                 motor.specifiedEfficiency, motor.motorRatedVoltage, motor.fullLoadAmps),
+          fieldVoltage(fieldVoltage), operatingHours(operatingHours), unitCost(unitCost), loadSolver(loadSolver)
+{}
+
+double PSATSweep::motorPower(const double loadFactor) const {
+    /// kWe = kW shaft / efficiency
+    return curves.getMotorRatedPower() * 0.746 * loadFactor / curves.efficiency(loadFactor);
+}
+
+PSATSweep::Output PSATSweep::calculate(const std::vector<double> &flowRates, const std::vector<double> &heads,
+                                       const std::vector<double> &loadFactors) const {
+    Output output;
+    output.flowRates = flowRates;
+    output.heads = heads;
+    output.loadFactors = loadFactors;
+    output.motorPowers.reserve(loadFactors.size());
+    for (auto const loadFactor : loadFactors) {
+        output.motorPowers.push_back(motorPower(loadFactor));
+    }
+    if (flowRates.empty() || heads.empty() || loadFactors.empty()) {
+        return output;
+    }
+
+    /// Existing motor and drive results per load factor; flow rate and head only enter the pump efficiency
+    std::vector<PSATResult::Output> existingAtLoad;
+    existingAtLoad.reserve(loadFactors.size());
+    for (auto const power : output.motorPowers) {
+        Pump::FieldData const fieldData(flowRates[0], heads[0], Motor::LoadEstimationMethod::POWER, power, 0,
+                                        fieldVoltage);
+        existingAtLoad.push_back(PSATResult::existingFromCurves(curves, pumpInput, fieldData, operatingHours, unitCost,
+                                                                loadSolver));
+    }
+
+    std::size_t const count = flowRates.size() * heads.size() * loadFactors.size();
+    output.existing.reserve(count);
+    output.modified.reserve(count);
+    for (auto const flowRate : flowRates) {
+        for (auto const head : heads) {
+            /// Modified results do not depend on the measured motor power
+            Pump::FieldData const fieldData(flowRate, head, Motor::LoadEstimationMethod::POWER, 0, 0, fieldVoltage);
+            PSATResult::Output const modified = PSATResult::modifiedFromCurves(curves, pumpInput, fieldData,
+                                                                               operatingHours, unitCost, loadSolver);
+            for (auto const & existing : existingAtLoad) {
+                output.existing.push_back(existing);
+                output.existing.back().pumpEfficiency = MoverEfficiency(pumpInput.specificGravity, flowRate, head,
+                                                                        existing.pumpShaftPower).calculate();
+                output.modified.push_back(modified);
+            }
+        }
+    }
+    return output;
+}
+
+double PSATSweep::Output::weightedAnnualSavings(const std::vector<double> &weights) const {
+    if (weights.size() != existing.size()) {
+        throw std::runtime_error("PSATSweep::Output::weightedAnnualSavings: one weight per grid point is required");
+    }
+    double savings = 0;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        savings += weights[i] * annualSavings(i);
+    }
+    return savings;
+}
@@ -93,10 +93,17 @@ PSATResult::Output PSATResult::calculateExisting()
      * 4	Calculate pump efficiency
      * 5	Calculate annual energy and energy cost
      */
-    MotorShaftPower motorShaftPower(motor.motorRatedPower, fieldData.motorPower, motor.motorRpm,
-                                    motor.lineFrequency, motor.efficiencyClass, motor.specifiedEfficiency,
-                                    motor.motorRatedVoltage, motor.fullLoadAmps, fieldData.voltage,
-                                    fieldData.loadEstimationMethod, fieldData.motorAmps);
+    MotorCurveSet const curves(motor.lineFrequency, motor.motorRpm, motor.efficiencyClass, motor.motorRatedPower,
+                               motor.specifiedEfficiency, motor.motorRatedVoltage, motor.fullLoadAmps);
+    return existingFromCurves(curves, pumpInput, fieldData, operatingHours, unitCost);
+}
+
+PSATResult::Output PSATResult::existingFromCurves(const MotorCurveSet &curves, const Pump::Input &pumpInput,
+                                                  const Pump::FieldData &fieldData, const double operatingHours,
+                                                  const double unitCost, const Motor::LoadSolver loadSolver)
+{
+    MotorShaftPower motorShaftPower(curves, fieldData.motorPower, fieldData.voltage, fieldData.loadEstimationMethod,
+                                    fieldData.motorAmps, loadSolver);
     auto const output = motorShaftPower.calculate();
 
     // existing.motorShaftPower = output.shaftPower;
@@ -128,7 +135,7 @@ PSATResult::Output PSATResult::calculateExisting()
     double annualCost = AnnualCost(annualEnergy, unitCost).calculate();
     // existing.annualCost = AnnualCost(existing.annualEnergy, unitCost).calculate();
 
-    return Output(pumpEfficiency, motor.motorRatedPower, output.shaftPower, pumpShaftPower.pumpShaftPower, output.efficiency,
+    return Output(pumpEfficiency, curves.getMotorRatedPower(), output.shaftPower, pumpShaftPower.pumpShaftPower, output.efficiency,
                   output.powerFactor, output.current, output.power, annualEnergy, annualCost, output.loadFactor, pumpShaftPower.driveEfficiency, output.estimatedFLA);
     // return existing;
 }
@@ -151,6 +158,24 @@ PSATResult::Output PSATResult::calculateModified()
 
      */
 
+    MotorCurveSet const curves(motor.lineFrequency, motor.motorRpm, motor.efficiencyClass, motor.motorRatedPower,
+                               motor.specifiedEfficiency, motor.motorRatedVoltage, motor.fullLoadAmps);
+    Output const output = modifiedFromCurves(curves, pumpInput, fieldData, operatingHours, unitCost);
+
+    // Annual Savings potential
+    //annualSavingsPotential = existing.annualCost - modified.annualCost;
+    annualSavingsPotential = 0.0;
+    // Optimization Rating
+    //optimizationRating = modified.motorPower / existing.motorPower;
+    optimizationRating = 0.0;
+
+    return output;
+}
+
+PSATResult::Output PSATResult::modifiedFromCurves(const MotorCurveSet &curves, const Pump::Input &pumpInput,
+                                                  const Pump::FieldData &fieldData, const double operatingHours,
+                                                  const double unitCost, const Motor::LoadSolver loadSolver)
+{
     // modified.pumpEfficiency = pumpInput.pumpEfficiency;
     OptimalPumpShaftPower modifiedPumpShaftPower(fieldData.flowRate, fieldData.head, pumpInput.specificGravity,
                                                  pumpInput.pumpEfficiency);
@@ -166,9 +191,7 @@ PSATResult::Output PSATResult::calculateModified()
 
     // modified.motorRatedPower = motor.motorRatedPower;
 
-    OptimalMotorPower modifiedMotorPower(motor.motorRatedPower, motor.motorRpm, motor.lineFrequency,
-                                         motor.efficiencyClass, motor.specifiedEfficiency,
-                                         motor.motorRatedVoltage, fieldData.voltage, motorShaftPowerOutput.motorShaftPower);
+    OptimalMotorPower modifiedMotorPower(curves, fieldData.voltage, motorShaftPowerOutput.motorShaftPower, loadSolver);
 
     // OptimalMotorPower modifiedMotorPower(modified.motorRatedPower, motor.motorRpm, motor.lineFrequency,
     //                                      motor.efficiencyClass, motor.specifiedEfficiency,
@@ -190,14 +213,7 @@ PSATResult::Output PSATResult::calculateModified()
     AnnualCost annualCost(annualEnergyCalculation, unitCost);
     double annualCostCalculation = annualCost.calculate();
 
-    // Annual Savings potential
-    //annualSavingsPotential = existing.annualCost - modified.annualCost;
-    annualSavingsPotential = 0.0;
-    // Optimization Rating
-    //optimizationRating = modified.motorPower / existing.motorPower;
-    optimizationRating = 0.0;
-
-    return Output(pumpInput.pumpEfficiency, motor.motorRatedPower, motorShaftPowerOutput.motorShaftPower, pumpShaftPower, output.efficiency,
+    return Output(pumpInput.pumpEfficiency, curves.getMotorRatedPower(), motorShaftPowerOutput.motorShaftPower, pumpShaftPower, output.efficiency,
                   output.powerFactor, output.current, output.power, annualEnergyCalculation, annualCostCalculation, output.loadFactor, motorShaftPowerOutput.driveEfficiency);
 
     // return modified;
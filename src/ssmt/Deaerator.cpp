@@ -21,6 +21,19 @@ Deaerator::Deaerator(const double deaeratorPressure, const double ventRate, cons
     calculateProperties();
 }
 
+Deaerator::Deaerator(const double deaeratorPressure, const double ventRate, const double feedwaterMassFlow,
+                     const SteamSystemModelerTool::SaturatedPropertiesOutput &saturatedProperties,
+                     const SteamSystemModelerTool::SteamPropertiesOutput &inletWaterProperties,
+                     const SteamSystemModelerTool::SteamPropertiesOutput &inletSteamProperties)
+        : deaeratorPressure(deaeratorPressure), ventRate(ventRate), feedwaterMassFlow(feedwaterMassFlow),
+          waterPressure(inletWaterProperties.pressure), waterQuantityValue(inletWaterProperties.specificEnthalpy),
+          steamPressure(inletSteamProperties.pressure), steamQuantityValue(inletSteamProperties.specificEnthalpy),
+          waterQuantityType(SteamProperties::ThermodynamicQuantity::ENTHALPY),
+          steamQuantityType(SteamProperties::ThermodynamicQuantity::ENTHALPY)
+{
+    calculateProperties(saturatedProperties, inletWaterProperties, inletSteamProperties);
+}
+
 
 std::ostream &operator<<(std::ostream &stream, const Deaerator &deaerator) {
     stream << "Deaerator["
@@ -43,6 +56,15 @@ std::ostream &operator<<(std::ostream &stream, const Deaerator &deaerator) {
 
 void Deaerator::calculateProperties() {
     auto const sp = SaturatedProperties(deaeratorPressure, SaturatedTemperature(deaeratorPressure).calculate()).calculate();
+	auto const inletWaterProps = SteamProperties(waterPressure, waterQuantityType, waterQuantityValue).calculate();
+	auto const inletSteamProps = SteamProperties(steamPressure, steamQuantityType, steamQuantityValue).calculate();
+
+	calculateProperties(sp, inletWaterProps, inletSteamProps);
+}
+
+void Deaerator::calculateProperties(const SteamSystemModelerTool::SaturatedPropertiesOutput &sp,
+                                    const SteamSystemModelerTool::SteamPropertiesOutput &inletWaterProps,
+                                    const SteamSystemModelerTool::SteamPropertiesOutput &inletSteamProps) {
 	SteamSystemModelerTool::SteamPropertiesOutput steamProps = {sp.temperature, sp.pressure, 0, sp.liquidSpecificVolume,
                                                              1/sp.liquidSpecificVolume, sp.liquidSpecificEnthalpy,
 																sp.liquidSpecificEntropy};
@@ -55,9 +77,6 @@ void Deaerator::calculateProperties() {
 			ventedSteamMassFlow, steamProps.specificEnthalpy * ventedSteamMassFlow, steamProps
 	};
 
-	auto inletWaterProps = SteamProperties(waterPressure, waterQuantityType, waterQuantityValue).calculate();
-	auto inletSteamProps = SteamProperties(steamPressure, steamQuantityType, steamQuantityValue).calculate();
-
     auto const totalDAMassFlow = ventedSteamMassFlow + feedwaterMassFlow;
     auto const totalOutletEnergyFlow = (feedwaterProperties.specificEnthalpy * feedwaterMassFlow
                                         + ventedSteamProperties.specificEnthalpy * ventedSteamMassFlow);
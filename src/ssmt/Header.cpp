@@ -7,6 +7,11 @@ Inlet::Inlet(const double pressure, const SteamProperties::ThermodynamicQuantity
     calculate();
 }
 
+Inlet::Inlet(const SteamSystemModelerTool::SteamPropertiesOutput &inletProperties, const double massFlow)
+        : pressure(inletProperties.pressure), quantityValue(inletProperties.specificEnthalpy), massFlow(massFlow),
+          quantityType(SteamProperties::ThermodynamicQuantity::ENTHALPY),
+          inletEnergyFlow(inletProperties.specificEnthalpy * massFlow), inletProperties(inletProperties) {}
+
 Header::Header(const double headerPressure, std::vector<Inlet> inletVec)
         : headerPressure(headerPressure), inlets(std::move(inletVec)) {
     calculate();
@@ -17,19 +17,72 @@ HeatLoss::HeatLoss(const double inletPressure, const SteamProperties::Thermodyna
 	calculateProperties();
 }
 
+HeatLoss::HeatLoss(const HeatLoss &previous, const double inletPressure,
+                   const SteamProperties::ThermodynamicQuantity quantityType, const double quantityValue,
+                   const double inletMassFlow, const double percentHeatLoss)
+        : inletPressure(inletPressure), quantityValue(quantityValue), inletMassFlow(inletMassFlow),
+          percentHeatLoss(percentHeatLoss / 100), quantityType(quantityType)
+{
+    if (canReuse(previous)) {
+        setFlows(previous.inletProperties, previous.outletProperties);
+        reusedFromPrevious = true;
+    } else {
+        calculateProperties();
+    }
+}
+
+std::vector<HeatLoss> HeatLoss::calculate(const std::vector<Input> &segments, const std::vector<HeatLoss> &previous) {
+    const bool hasPrevious = previous.size() == segments.size();
+
+    std::vector<HeatLoss> results;
+    results.reserve(segments.size());
+    for (std::size_t i = 0; i < segments.size(); i++) {
+        const Input &in = segments[i];
+        if (hasPrevious) {
+            results.emplace_back(previous[i], in.inletPressure, in.quantityType, in.quantityValue, in.inletMassFlow,
+                                 in.percentHeatLoss);
+        } else if (!results.empty()) {
+            results.emplace_back(results.back(), in.inletPressure, in.quantityType, in.quantityValue,
+                                 in.inletMassFlow, in.percentHeatLoss);
+        } else {
+            results.emplace_back(in.inletPressure, in.quantityType, in.quantityValue, in.inletMassFlow,
+                                 in.percentHeatLoss);
+        }
+    }
+    return results;
+}
+
 void HeatLoss::calculateProperties() {
-	auto sp = SteamProperties(inletPressure, quantityType, quantityValue).calculate();
-	inletEnergyFlow = sp.specificEnthalpy * inletMassFlow;
-	outletEnergyFlow = inletEnergyFlow * (1 - percentHeatLoss);
+    const auto inletSteam = SteamProperties(inletPressure, quantityType, quantityValue).calculate();
+    const double outletEnergy = inletSteam.specificEnthalpy * inletMassFlow * (1 - percentHeatLoss);
+
+    const double qtyValueCalc = (inletMassFlow == 0.0) ? inletSteam.specificEnthalpy : outletEnergy / inletMassFlow;
+    const auto outletSteam = SteamProperties(inletPressure, SteamProperties::ThermodynamicQuantity::ENTHALPY,
+                                             qtyValueCalc).calculate();
+
+    setFlows(inletSteam, outletSteam);
+    reusedFromPrevious = false;
+}
 
-	inletProperties = {inletMassFlow, inletEnergyFlow, sp};
+/**
+ * The outlet steam state depends only on the inlet state and the percent heat loss (the mass flow cancels out of the
+ * outlet enthalpy), so a zero/non-zero mass flow is the only flow condition that must match.
+ */
+bool HeatLoss::canReuse(const HeatLoss &previous) const {
+    return previous.inletPressure == inletPressure && previous.quantityType == quantityType
+           && previous.quantityValue == quantityValue && previous.percentHeatLoss == percentHeatLoss
+           && (previous.inletMassFlow == 0.0) == (inletMassFlow == 0.0);
+}
 
-    const double qtyValueCalc = (inletMassFlow == 0.0) ? sp.specificEnthalpy : outletEnergyFlow / inletMassFlow;
-    sp = SteamProperties(inletPressure, SteamProperties::ThermodynamicQuantity::ENTHALPY, qtyValueCalc).calculate();
+void HeatLoss::setFlows(const SteamSystemModelerTool::SteamPropertiesOutput &inletSteam,
+                        const SteamSystemModelerTool::SteamPropertiesOutput &outletSteam) {
+    inletEnergyFlow = inletSteam.specificEnthalpy * inletMassFlow;
+    outletEnergyFlow = inletEnergyFlow * (1 - percentHeatLoss);
 
-	outletProperties = {inletMassFlow, outletEnergyFlow, sp};
+    inletProperties = {inletMassFlow, inletEnergyFlow, inletSteam};
+    outletProperties = {inletMassFlow, outletEnergyFlow, outletSteam};
 
-	heatLoss = inletEnergyFlow - outletEnergyFlow;
+    heatLoss = inletEnergyFlow - outletEnergyFlow;
 }
 
 std::ostream &operator<<(std::ostream &stream, const HeatLoss &heatLoss) {
@@ -2,7 +2,16 @@
 #include "ssmt/SteamProperties.h"
 #include "ssmt/SaturatedProperties.h"
 
+namespace {
+	thread_local unsigned long long calculationCount = 0;
+}
+
+unsigned long long SteamProperties::getCalculationCount() {
+	return calculationCount;
+}
+
 SteamSystemModelerTool::SteamPropertiesOutput SteamProperties::calculate() {
+	++calculationCount;
 	switch (thermodynamicQuantity_) {
 		case ThermodynamicQuantity::TEMPERATURE:
 			return waterPropertiesPressureTemperature(this->pressure_, this->quantityValue_);
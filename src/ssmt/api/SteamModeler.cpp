@@ -8,20 +8,45 @@ SteamModelerOutput SteamModeler::model(const SteamModelerInput &steamModelerInpu
     const TurbineInput &turbineInput = steamModelerInput.getTurbineInput();
     const OperationsInput &operationsInput = steamModelerInput.getOperationsInput();
 
-    return modeler(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput, operationsInput);
+    SteamModelerCache &cache = SteamModelerCache::instance();
+    if (!cache.isEnabled()) {
+        SteamBalanceTrace trace;
+        return modeler(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput, operationsInput,
+                       trace);
+    }
+
+    const std::string &key = cache.makeKey(steamModelerInput);
+    const std::shared_ptr<SteamModelerOutput> &cachedOutput = cache.find(key);
+    if (cachedOutput != nullptr) {
+        return *cachedOutput;
+    }
+
+    SteamBalanceTrace trace;
+    const SteamModelerOutput &steamModelerOutput =
+            modeler(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput, operationsInput,
+                    trace);
+    cache.store(key, steamModelerOutput);
+    return steamModelerOutput;
+}
+
+SteamModelerOutput SteamModeler::model(const SteamModelerInput &steamModelerInput, SteamBalanceTrace &trace) {
+    return modeler(steamModelerInput.isBaselineCalc(), steamModelerInput.getBaselinePowerDemand(),
+                   steamModelerInput.getHeaderInput(), steamModelerInput.getBoilerInput(),
+                   steamModelerInput.getTurbineInput(), steamModelerInput.getOperationsInput(), trace);
 }
 
 SteamModelerOutput
 SteamModeler::modeler(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
                     const BoilerInput &boilerInput, const TurbineInput &turbineInput,
-                    const OperationsInput &operationsInput) {
+                    const OperationsInput &operationsInput, SteamBalanceTrace &trace) {
     const std::string methodName = "SteamModeler::" + std::string(__func__) + ": ";
 
     logInputData(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput, operationsInput);
 
     logSection(methodName + "running calculations: begin");
     const SteamModelCalculationsDomain &steamModelCalculationsDomain =
-            runModel(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput, operationsInput);
+            runModel(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput, operationsInput,
+                     trace);
     logSection(methodName + "running calculations: end");
 
     logSection(methodName + "populating output from calculations results: begin");
@@ -52,10 +77,10 @@ SteamModeler::logInputData(const bool isBaselineCalc, const double baselinePower
 SteamModelCalculationsDomain
 SteamModeler::runModel(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
                        const BoilerInput &boilerInput, const TurbineInput &turbineInput,
-                       const OperationsInput &operationsInput) const {
+                       const OperationsInput &operationsInput, SteamBalanceTrace &trace) const {
     try {
         return steamModelRunner.run(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput,
-                                    operationsInput);
+                                    operationsInput, trace);
     } catch (std::exception &e) {
         logException(e, "SteamModeler::runModel: exception running the steam model: ");
         throw;
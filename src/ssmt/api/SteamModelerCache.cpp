@@ -0,0 +1,106 @@
+#include "ssmt/api/SteamModelerCache.h"
+
+double SteamModelerCache::Statistics::hitRate() const {
+    const std::size_t lookups = hits + misses;
+    return lookups == 0 ? 0 : static_cast<double>(hits) / lookups;
+}
+
+SteamModelerCache &SteamModelerCache::instance() {
+    static SteamModelerCache cache;
+    return cache;
+}
+
+SteamModelerCache::SteamModelerCache(const std::size_t budgetBytes) : budgetBytes(budgetBytes) {}
+
+void SteamModelerCache::setBudget(const std::size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->budgetBytes = budgetBytes;
+    evictToBudget();
+}
+
+bool SteamModelerCache::isEnabled() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return budgetBytes > 0;
+}
+
+std::string SteamModelerCache::makeKey(const SteamModelerInput &input) const {
+    const TurbineInput &turbineInput = input.getTurbineInput();
+    const CondensingTurbine &condensingTurbine = turbineInput.getCondensingTurbine();
+    const auto canonicalPressureTurbine = [](const PressureTurbine &turbine) {
+        return turbine.isUseTurbine() ? turbine
+                                      : PressureTurbine(0, 0, PressureTurbineOperation::STEAM_FLOW, 0, 0, false);
+    };
+    const TurbineInput canonicalTurbineInput = {
+            condensingTurbine.isUseTurbine() ? condensingTurbine
+                                             : CondensingTurbine(0, 0, 0, CondensingTurbineOperation::STEAM_FLOW, 0,
+                                                                 false),
+            canonicalPressureTurbine(turbineInput.getHighToLowTurbine()),
+            canonicalPressureTurbine(turbineInput.getHighToMediumTurbine()),
+            canonicalPressureTurbine(turbineInput.getMediumToLowTurbine())};
+
+    const SteamModelerInput canonicalInput = {input.isBaselineCalc(), input.getBaselinePowerDemand(),
+                                              input.getBoilerInput(), input.getHeaderInput(),
+                                              input.getOperationsInput(), canonicalTurbineInput};
+    return serializer.serialize(canonicalInput);
+}
+
+std::shared_ptr<SteamModelerOutput> SteamModelerCache::find(const std::string &key) {
+    std::string output;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = entries.find(key);
+        if (it == entries.end()) {
+            misses++;
+            return nullptr;
+        }
+        hits++;
+        recency.splice(recency.begin(), recency, it->second.recency);
+        output = it->second.output;
+    }
+    return std::make_shared<SteamModelerOutput>(serializer.deserializeOutput(output));
+}
+
+void SteamModelerCache::store(const std::string &key, const SteamModelerOutput &output) {
+    std::string data = serializer.serialize(output);
+    const std::size_t size = key.size() + data.size();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size > budgetBytes) return;
+
+    const auto it = entries.find(key);
+    if (it != entries.end()) {
+        bytesUsed -= key.size() + it->second.output.size();
+        recency.erase(it->second.recency);
+        entries.erase(it);
+    }
+
+    // unordered_map keys keep their address across rehashing, so recency can point at them
+    const auto inserted = entries.emplace(key, Entry{std::move(data), recency.end()}).first;
+    recency.push_front(&inserted->first);
+    inserted->second.recency = recency.begin();
+    bytesUsed += size;
+    evictToBudget();
+}
+
+void SteamModelerCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    recency.clear();
+    entries.clear();
+    bytesUsed = 0;
+}
+
+SteamModelerCache::Statistics SteamModelerCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return {hits, misses, evictions, entries.size(), bytesUsed, budgetBytes};
+}
+
+void SteamModelerCache::evictToBudget() {
+    while (bytesUsed > budgetBytes && !recency.empty()) {
+        const std::string &key = *recency.back();
+        const auto it = entries.find(key);
+        bytesUsed -= key.size() + it->second.output.size();
+        recency.pop_back();
+        entries.erase(it);
+        evictions++;
+    }
+}
@@ -0,0 +1,787 @@
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include "ssmt/api/SteamModelerSerializer.h"
+
+namespace {
+    const char MAGIC[4] = {'A', 'M', 'O', 'S'};
+    const std::uint8_t KIND_INPUT = 1;
+    const std::uint8_t KIND_OUTPUT = 2;
+    const std::uint16_t BYTE_ORDER_MARK = 0xFEFF;
+}
+
+const std::uint32_t SteamModelerSerializer::VERSION = 1;
+
+class SteamModelerSerializer::Writer {
+public:
+    explicit Writer(const std::uint8_t kind) {
+        buffer.append(MAGIC, sizeof(MAGIC));
+        putRaw(VERSION);
+        putRaw(kind);
+        putRaw(static_cast<std::uint8_t>(0));
+        putRaw(BYTE_ORDER_MARK);
+    }
+
+    void put(const double value) { putRaw(value); }
+
+    void put(const bool value) { putRaw(static_cast<std::uint8_t>(value ? 1 : 0)); }
+
+    template<typename E>
+    void putEnum(const E value) { putRaw(static_cast<std::int32_t>(value)); }
+
+    void put(const SteamSystemModelerTool::SteamPropertiesOutput &props) {
+        put(props.temperature);
+        put(props.pressure);
+        put(props.quality);
+        put(props.specificVolume);
+        put(props.density);
+        put(props.specificEnthalpy);
+        put(props.specificEntropy);
+        put(props.internalEnergy);
+    }
+
+    void put(const SteamSystemModelerTool::FluidProperties &props) {
+        put(static_cast<const SteamSystemModelerTool::SteamPropertiesOutput &>(props));
+        put(props.massFlow);
+        put(props.energyFlow);
+    }
+
+    /** Writes the presence byte of an optional member; returns true if the member itself must follow. */
+    template<typename T>
+    bool putPresent(const std::shared_ptr<T> &ptr) {
+        put(ptr != nullptr);
+        return ptr != nullptr;
+    }
+
+    const std::string &data() const { return buffer; }
+
+private:
+    template<typename T>
+    void putRaw(const T value) { buffer.append(reinterpret_cast<const char *>(&value), sizeof(T)); }
+
+    std::string buffer;
+};
+
+class SteamModelerSerializer::Reader {
+public:
+    Reader(const char *data, const std::size_t size, const std::uint8_t kind)
+            : pos(data), end(data + size) {
+        if (size < sizeof(MAGIC) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("SteamModelerSerializer: data is not a serialized steam model");
+        }
+        pos += sizeof(MAGIC);
+
+        const auto version = getRaw<std::uint32_t>();
+        const auto actualKind = getRaw<std::uint8_t>();
+        getRaw<std::uint8_t>();
+        const auto byteOrderMark = getRaw<std::uint16_t>();
+        if (version != VERSION) {
+            throw std::runtime_error("SteamModelerSerializer: unsupported format version " + std::to_string(version));
+        }
+        if (byteOrderMark != BYTE_ORDER_MARK) {
+            throw std::runtime_error("SteamModelerSerializer: data was written with a different byte order");
+        }
+        if (actualKind != kind) {
+            throw std::runtime_error("SteamModelerSerializer: data does not hold the requested payload kind");
+        }
+    }
+
+    double getDouble() { return getRaw<double>(); }
+
+    bool getBool() { return getRaw<std::uint8_t>() != 0; }
+
+    template<typename E>
+    E getEnum() { return static_cast<E>(getRaw<std::int32_t>()); }
+
+    SteamSystemModelerTool::SteamPropertiesOutput getSteamProperties() {
+        SteamSystemModelerTool::SteamPropertiesOutput props;
+        props.temperature = getDouble();
+        props.pressure = getDouble();
+        props.quality = getDouble();
+        props.specificVolume = getDouble();
+        props.density = getDouble();
+        props.specificEnthalpy = getDouble();
+        props.specificEntropy = getDouble();
+        props.internalEnergy = getDouble();
+        return props;
+    }
+
+    SteamSystemModelerTool::FluidProperties getFluidProperties() {
+        const auto &props = getSteamProperties();
+        const double massFlow = getDouble();
+        const double energyFlow = getDouble();
+        return {massFlow, energyFlow, props};
+    }
+
+    void checkFullyRead() const {
+        if (pos != end) {
+            throw std::runtime_error("SteamModelerSerializer: unexpected trailing data");
+        }
+    }
+
+private:
+    template<typename T>
+    T getRaw() {
+        if (static_cast<std::size_t>(end - pos) < sizeof(T)) {
+            throw std::runtime_error("SteamModelerSerializer: serialized data is truncated");
+        }
+        T value;
+        std::memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    const char *pos;
+    const char *const end;
+};
+
+std::string SteamModelerSerializer::serialize(const SteamModelerInput &input) const {
+    Writer writer(KIND_INPUT);
+    writer.put(input.isBaselineCalc());
+    writer.put(input.getBaselinePowerDemand());
+
+    const BoilerInput &boiler = input.getBoilerInput();
+    writer.put(boiler.getFuelType());
+    writer.put(boiler.getFuel());
+    writer.put(boiler.getCombustionEfficiency());
+    writer.put(boiler.getBlowdownRate());
+    writer.put(boiler.isBlowdownFlashed());
+    writer.put(boiler.isPreheatMakeupWater());
+    writer.put(boiler.getSteamTemperature());
+    writer.put(boiler.getDeaeratorVentRate());
+    writer.put(boiler.getDeaeratorPressure());
+    writer.put(boiler.getApproachTemperature());
+
+    const HeaderInput &headers = input.getHeaderInput();
+    const HeaderWithHighestPressure &highPressureHeader = headers.getHighPressureHeader();
+    writer.put(highPressureHeader.getPressure());
+    writer.put(highPressureHeader.getProcessSteamUsage());
+    writer.put(highPressureHeader.getCondensationRecoveryRate());
+    writer.put(highPressureHeader.getHeatLoss());
+    writer.put(highPressureHeader.getCondensateReturnTemperature());
+    writer.put(highPressureHeader.isFlashCondensate());
+    for (const auto &header : {headers.getMediumPressureHeader(), headers.getLowPressureHeader()}) {
+        if (writer.putPresent(header)) {
+            writer.put(header->getPressure());
+            writer.put(header->getProcessSteamUsage());
+            writer.put(header->getCondensationRecoveryRate());
+            writer.put(header->getHeatLoss());
+            writer.put(header->isFlashCondensate());
+            writer.put(header->isDesuperheatSteamIntoNextHighest());
+            writer.put(header->getDesuperheatSteamTemperature());
+        }
+    }
+
+    const OperationsInput &operations = input.getOperationsInput();
+    writer.put(operations.getSitePowerImport());
+    writer.put(operations.getMakeUpWaterTemperature());
+    writer.put(operations.getOperatingHoursPerYear());
+    writer.put(operations.getFuelCosts());
+    writer.put(operations.getElectricityCosts());
+    writer.put(operations.getMakeUpWaterCosts());
+
+    const TurbineInput &turbines = input.getTurbineInput();
+    const CondensingTurbine &condensingTurbine = turbines.getCondensingTurbine();
+    writer.put(condensingTurbine.getIsentropicEfficiency());
+    writer.put(condensingTurbine.getGenerationEfficiency());
+    writer.put(condensingTurbine.getCondenserPressure());
+    writer.putEnum(condensingTurbine.getOperationType());
+    writer.put(condensingTurbine.getOperationValue());
+    writer.put(condensingTurbine.isUseTurbine());
+    for (const auto &turbine : {turbines.getHighToLowTurbine(), turbines.getHighToMediumTurbine(),
+                                turbines.getMediumToLowTurbine()}) {
+        writer.put(turbine.getIsentropicEfficiency());
+        writer.put(turbine.getGenerationEfficiency());
+        writer.putEnum(turbine.getOperationType());
+        writer.put(turbine.getOperationValue1());
+        writer.put(turbine.getOperationValue2());
+        writer.put(turbine.isUseTurbine());
+    }
+
+    return writer.data();
+}
+
+SteamModelerInput SteamModelerSerializer::deserializeInput(const char *data, const std::size_t size) const {
+    Reader reader(data, size, KIND_INPUT);
+    const bool isBaselineCalc = reader.getBool();
+    const double baselinePowerDemand = reader.getDouble();
+
+    const double fuelType = reader.getDouble();
+    const double fuel = reader.getDouble();
+    const double combustionEfficiency = reader.getDouble();
+    const double blowdownRate = reader.getDouble();
+    const bool blowdownFlashed = reader.getBool();
+    const bool preheatMakeupWater = reader.getBool();
+    const double steamTemperature = reader.getDouble();
+    const double deaeratorVentRate = reader.getDouble();
+    const double deaeratorPressure = reader.getDouble();
+    const double approachTemperature = reader.getDouble();
+    const BoilerInput boilerInput = {fuelType, fuel, combustionEfficiency, blowdownRate, blowdownFlashed,
+                                     preheatMakeupWater, steamTemperature, deaeratorVentRate, deaeratorPressure,
+                                     approachTemperature};
+
+    const double pressure = reader.getDouble();
+    const double processSteamUsage = reader.getDouble();
+    const double condensationRecoveryRate = reader.getDouble();
+    const double heatLoss = reader.getDouble();
+    const double condensateReturnTemperature = reader.getDouble();
+    const bool flashCondensate = reader.getBool();
+    const HeaderWithHighestPressure highPressureHeader = {pressure, processSteamUsage, condensationRecoveryRate,
+                                                          heatLoss, condensateReturnTemperature, flashCondensate};
+    std::shared_ptr<HeaderNotHighestPressure> notHighestPressureHeaders[2];
+    for (auto &header : notHighestPressureHeaders) {
+        if (reader.getBool()) {
+            const double headerPressure = reader.getDouble();
+            const double headerProcessSteamUsage = reader.getDouble();
+            const double headerCondensationRecoveryRate = reader.getDouble();
+            const double headerHeatLoss = reader.getDouble();
+            const bool flashCondensateIntoHeader = reader.getBool();
+            const bool desuperheatSteamIntoNextHighest = reader.getBool();
+            const double desuperheatSteamTemperature = reader.getDouble();
+            header = std::make_shared<HeaderNotHighestPressure>(headerPressure, headerProcessSteamUsage,
+                                                                headerCondensationRecoveryRate, headerHeatLoss,
+                                                                flashCondensateIntoHeader,
+                                                                desuperheatSteamIntoNextHighest,
+                                                                desuperheatSteamTemperature);
+        }
+    }
+    const HeaderInput headerInput = {highPressureHeader, notHighestPressureHeaders[0], notHighestPressureHeaders[1]};
+
+    const double sitePowerImport = reader.getDouble();
+    const double makeUpWaterTemperature = reader.getDouble();
+    const double operatingHoursPerYear = reader.getDouble();
+    const double fuelCosts = reader.getDouble();
+    const double electricityCosts = reader.getDouble();
+    const double makeUpWaterCosts = reader.getDouble();
+    const OperationsInput operationsInput = {sitePowerImport, makeUpWaterTemperature, operatingHoursPerYear,
+                                             fuelCosts, electricityCosts, makeUpWaterCosts};
+
+    const double isentropicEfficiency = reader.getDouble();
+    const double generationEfficiency = reader.getDouble();
+    const double condenserPressure = reader.getDouble();
+    const auto condensingOperationType = reader.getEnum<CondensingTurbineOperation>();
+    const double operationValue = reader.getDouble();
+    const bool useTurbine = reader.getBool();
+    const CondensingTurbine condensingTurbine = {isentropicEfficiency, generationEfficiency, condenserPressure,
+                                                 condensingOperationType, operationValue, useTurbine};
+    std::vector<PressureTurbine> pressureTurbines;
+    for (int i = 0; i < 3; i++) {
+        const double turbineIsentropicEfficiency = reader.getDouble();
+        const double turbineGenerationEfficiency = reader.getDouble();
+        const auto operationType = reader.getEnum<PressureTurbineOperation>();
+        const double operationValue1 = reader.getDouble();
+        const double operationValue2 = reader.getDouble();
+        const bool useThisTurbine = reader.getBool();
+        pressureTurbines.emplace_back(turbineIsentropicEfficiency, turbineGenerationEfficiency, operationType,
+                                      operationValue1, operationValue2, useThisTurbine);
+    }
+    const TurbineInput turbineInput = {condensingTurbine, pressureTurbines[0], pressureTurbines[1],
+                                       pressureTurbines[2]};
+
+    reader.checkFullyRead();
+    return {isBaselineCalc, baselinePowerDemand, boilerInput, headerInput, operationsInput, turbineInput};
+}
+
+SteamModelerInput SteamModelerSerializer::deserializeInput(const std::string &data) const {
+    return deserializeInput(data.data(), data.size());
+}
+
+std::string SteamModelerSerializer::serialize(const SteamModelerOutput &output) const {
+    Writer writer(KIND_OUTPUT);
+    write(writer, output.boiler);
+    write(writer, output.blowdownFlashTank);
+    write(writer, output.highPressureHeaderCalculationsDomain);
+    write(writer, output.mediumPressureHeaderCalculationsDomain);
+    write(writer, output.lowPressureHeaderCalculationsDomain);
+    write(writer, output.makeupWaterAndCondensateHeaderCalculationsDomain);
+    write(writer, output.deaerator);
+    write(writer, output.powerBalanceCheckerCalculationsDomain);
+    write(writer, output.processSteamUsageCalculationsDomain);
+    write(writer, output.energyAndCostCalculationsDomain);
+    return writer.data();
+}
+
+SteamModelerOutput SteamModelerSerializer::deserializeOutput(const char *data, const std::size_t size) const {
+    Reader reader(data, size, KIND_OUTPUT);
+    const Boiler &boiler = readBoiler(reader);
+    const std::shared_ptr<FlashTank> &blowdownFlashTank = readFlashTank(reader);
+    const HighPressureHeaderCalculationsDomain &highPressureHeader = readHighPressureHeader(reader);
+    const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeader =
+            readMediumPressureHeader(reader);
+    const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeader = readLowPressureHeader(reader);
+    const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeader =
+            readMakeupWaterAndCondensateHeader(reader);
+    const Deaerator &deaerator = readDeaerator(reader);
+    const PowerBalanceCheckerCalculationsDomain &powerBalanceChecker = readPowerBalanceChecker(reader);
+    const ProcessSteamUsageCalculationsDomain &processSteamUsage = readProcessSteamUsage(reader);
+    const EnergyAndCostCalculationsDomain &energyAndCost = readEnergyAndCost(reader);
+    reader.checkFullyRead();
+
+    return {boiler, blowdownFlashTank, highPressureHeader, mediumPressureHeader, lowPressureHeader,
+            makeupWaterAndCondensateHeader, deaerator, powerBalanceChecker, processSteamUsage, energyAndCost};
+}
+
+SteamModelerOutput SteamModelerSerializer::deserializeOutput(const std::string &data) const {
+    return deserializeOutput(data.data(), data.size());
+}
+
+void SteamModelerSerializer::write(Writer &writer, const Boiler &boiler) const {
+    writer.put(boiler.deaeratorPressure);
+    writer.put(boiler.combustionEfficiency);
+    writer.put(boiler.blowdownRate);
+    writer.put(boiler.steamPressure);
+    writer.putEnum(boiler.quantityType);
+    writer.put(boiler.quantityValue);
+    writer.put(boiler.steamMassFlow);
+    writer.put(boiler.steamProperties);
+    writer.put(boiler.blowdownProperties);
+    writer.put(boiler.feedwaterProperties);
+    writer.put(boiler.boilerEnergy);
+    writer.put(boiler.fuelEnergy);
+}
+
+Boiler SteamModelerSerializer::readBoiler(Reader &reader) const {
+    Boiler boiler;
+    boiler.deaeratorPressure = reader.getDouble();
+    boiler.combustionEfficiency = reader.getDouble();
+    boiler.blowdownRate = reader.getDouble();
+    boiler.steamPressure = reader.getDouble();
+    boiler.quantityType = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    boiler.quantityValue = reader.getDouble();
+    boiler.steamMassFlow = reader.getDouble();
+    boiler.steamProperties = reader.getFluidProperties();
+    boiler.blowdownProperties = reader.getFluidProperties();
+    boiler.feedwaterProperties = reader.getFluidProperties();
+    boiler.boilerEnergy = reader.getDouble();
+    boiler.fuelEnergy = reader.getDouble();
+    return boiler;
+}
+
+void SteamModelerSerializer::write(Writer &writer, const std::shared_ptr<FlashTank> &flashTank) const {
+    if (writer.putPresent(flashTank)) {
+        writer.put(flashTank->inletWaterPressure);
+        writer.put(flashTank->quantityValue);
+        writer.put(flashTank->inletWaterMassFlow);
+        writer.put(flashTank->tankPressure);
+        writer.putEnum(flashTank->quantityType);
+        writer.put(flashTank->inletWaterProperties);
+        writer.put(flashTank->outletLiquidSaturatedProperties);
+        writer.put(flashTank->outletGasSaturatedProperties);
+    }
+}
+
+std::shared_ptr<FlashTank> SteamModelerSerializer::readFlashTank(Reader &reader) const {
+    if (!reader.getBool()) return nullptr;
+
+    std::shared_ptr<FlashTank> flashTank(new FlashTank());
+    flashTank->inletWaterPressure = reader.getDouble();
+    flashTank->quantityValue = reader.getDouble();
+    flashTank->inletWaterMassFlow = reader.getDouble();
+    flashTank->tankPressure = reader.getDouble();
+    flashTank->quantityType = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    flashTank->inletWaterProperties = reader.getFluidProperties();
+    flashTank->outletLiquidSaturatedProperties = reader.getFluidProperties();
+    flashTank->outletGasSaturatedProperties = reader.getFluidProperties();
+    return flashTank;
+}
+
+void SteamModelerSerializer::write(Writer &writer, const std::shared_ptr<PrvWithoutDesuperheating> &prv) const {
+    if (!writer.putPresent(prv)) return;
+
+    writer.put(prv->isWithDesuperheating());
+    writer.put(prv->inletPressure);
+    writer.put(prv->quantityValue);
+    writer.put(prv->inletMassFlow);
+    writer.put(prv->outletPressure);
+    writer.put(prv->inletProperties);
+    writer.put(prv->outletProperties);
+    writer.putEnum(prv->quantityType);
+    writer.put(prv->inletEnergyFlow);
+
+    if (prv->isWithDesuperheating()) {
+        const auto &prvWith = std::static_pointer_cast<PrvWithDesuperheating>(prv);
+        writer.put(prvWith->feedwaterPressure);
+        writer.put(prvWith->feedwaterQuantityValue);
+        writer.put(prvWith->desuperheatingTemp);
+        writer.putEnum(prvWith->feedwaterQuantityType);
+        writer.put(prvWith->feedwaterProperties);
+        writer.put(prvWith->inletEnergyFlow);
+        writer.put(prvWith->outletMassFlow);
+        writer.put(prvWith->outletEnergyFlow);
+        writer.put(prvWith->feedwaterMassFlow);
+        writer.put(prvWith->feedwaterEnergyFlow);
+    }
+}
+
+std::shared_ptr<PrvWithoutDesuperheating> SteamModelerSerializer::readPrv(Reader &reader) const {
+    if (!reader.getBool()) return nullptr;
+
+    const bool isWithDesuperheating = reader.getBool();
+    PrvWithDesuperheating *prvWith = isWithDesuperheating ? new PrvWithDesuperheating() : nullptr;
+    std::shared_ptr<PrvWithoutDesuperheating> prv(
+            isWithDesuperheating ? prvWith : new PrvWithoutDesuperheating());
+
+    prv->inletPressure = reader.getDouble();
+    prv->quantityValue = reader.getDouble();
+    prv->inletMassFlow = reader.getDouble();
+    prv->outletPressure = reader.getDouble();
+    prv->inletProperties = reader.getSteamProperties();
+    prv->outletProperties = reader.getSteamProperties();
+    prv->quantityType = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    prv->inletEnergyFlow = reader.getDouble();
+
+    if (isWithDesuperheating) {
+        prvWith->feedwaterPressure = reader.getDouble();
+        prvWith->feedwaterQuantityValue = reader.getDouble();
+        prvWith->desuperheatingTemp = reader.getDouble();
+        prvWith->feedwaterQuantityType = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+        prvWith->feedwaterProperties = reader.getSteamProperties();
+        prvWith->inletEnergyFlow = reader.getDouble();
+        prvWith->outletMassFlow = reader.getDouble();
+        prvWith->outletEnergyFlow = reader.getDouble();
+        prvWith->feedwaterMassFlow = reader.getDouble();
+        prvWith->feedwaterEnergyFlow = reader.getDouble();
+    }
+    return prv;
+}
+
+void SteamModelerSerializer::write(Writer &writer, const std::shared_ptr<Turbine> &turbine) const {
+    if (writer.putPresent(turbine)) {
+        writer.putEnum(turbine->solveFor);
+        writer.put(turbine->inletPressure);
+        writer.put(turbine->isentropicEfficiency);
+        writer.put(turbine->generatorEfficiency);
+        writer.put(turbine->massFlowOrPowerOut);
+        writer.put(turbine->outletSteamPressure);
+        writer.putEnum(turbine->inletQuantity);
+        writer.putEnum(turbine->outletQuantity);
+        writer.put(turbine->inletQuantityValue);
+        writer.put(turbine->outletQuantityValue);
+        writer.putEnum(turbine->turbineProperty);
+        writer.put(turbine->inletProperties);
+        writer.put(turbine->outletProperties);
+        writer.put(turbine->inletEnergyFlow);
+        writer.put(turbine->outletEnergyFlow);
+        writer.put(turbine->energyOut);
+        writer.put(turbine->powerOut);
+        writer.put(turbine->massFlow);
+    }
+}
+
+std::shared_ptr<Turbine> SteamModelerSerializer::readTurbine(Reader &reader) const {
+    if (!reader.getBool()) return nullptr;
+
+    std::shared_ptr<Turbine> turbine(new Turbine());
+    turbine->solveFor = reader.getEnum<Turbine::Solve>();
+    turbine->inletPressure = reader.getDouble();
+    turbine->isentropicEfficiency = reader.getDouble();
+    turbine->generatorEfficiency = reader.getDouble();
+    turbine->massFlowOrPowerOut = reader.getDouble();
+    turbine->outletSteamPressure = reader.getDouble();
+    turbine->inletQuantity = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    turbine->outletQuantity = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    turbine->inletQuantityValue = reader.getDouble();
+    turbine->outletQuantityValue = reader.getDouble();
+    turbine->turbineProperty = reader.getEnum<Turbine::TurbineProperty>();
+    turbine->inletProperties = reader.getSteamProperties();
+    turbine->outletProperties = reader.getSteamProperties();
+    turbine->inletEnergyFlow = reader.getDouble();
+    turbine->outletEnergyFlow = reader.getDouble();
+    turbine->energyOut = reader.getDouble();
+    turbine->powerOut = reader.getDouble();
+    turbine->massFlow = reader.getDouble();
+    return turbine;
+}
+
+void SteamModelerSerializer::write(Writer &writer, const Deaerator &deaerator) const {
+    writer.put(deaerator.deaeratorPressure);
+    writer.put(deaerator.ventRate);
+    writer.put(deaerator.feedwaterMassFlow);
+    writer.put(deaerator.waterPressure);
+    writer.put(deaerator.waterQuantityValue);
+    writer.put(deaerator.steamPressure);
+    writer.put(deaerator.steamQuantityValue);
+    writer.putEnum(deaerator.waterQuantityType);
+    writer.putEnum(deaerator.steamQuantityType);
+    writer.put(deaerator.feedwaterProperties);
+    writer.put(deaerator.ventedSteamProperties);
+    writer.put(deaerator.inletWaterProperties);
+    writer.put(deaerator.inletSteamProperties);
+}
+
+Deaerator SteamModelerSerializer::readDeaerator(Reader &reader) const {
+    Deaerator deaerator;
+    deaerator.deaeratorPressure = reader.getDouble();
+    deaerator.ventRate = reader.getDouble();
+    deaerator.feedwaterMassFlow = reader.getDouble();
+    deaerator.waterPressure = reader.getDouble();
+    deaerator.waterQuantityValue = reader.getDouble();
+    deaerator.steamPressure = reader.getDouble();
+    deaerator.steamQuantityValue = reader.getDouble();
+    deaerator.waterQuantityType = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    deaerator.steamQuantityType = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    deaerator.feedwaterProperties = reader.getFluidProperties();
+    deaerator.ventedSteamProperties = reader.getFluidProperties();
+    deaerator.inletWaterProperties = reader.getFluidProperties();
+    deaerator.inletSteamProperties = reader.getFluidProperties();
+    return deaerator;
+}
+
+void SteamModelerSerializer::write(Writer &writer, const HeatLoss &heatLoss) const {
+    writer.put(heatLoss.inletPressure);
+    writer.put(heatLoss.quantityValue);
+    writer.put(heatLoss.inletMassFlow);
+    writer.put(heatLoss.percentHeatLoss);
+    writer.put(heatLoss.inletProperties);
+    writer.put(heatLoss.inletEnergyFlow);
+    writer.put(heatLoss.outletEnergyFlow);
+    writer.put(heatLoss.outletProperties);
+    writer.put(heatLoss.heatLoss);
+    writer.putEnum(heatLoss.quantityType);
+}
+
+HeatLoss SteamModelerSerializer::readHeatLoss(Reader &reader) const {
+    HeatLoss heatLoss;
+    heatLoss.inletPressure = reader.getDouble();
+    heatLoss.quantityValue = reader.getDouble();
+    heatLoss.inletMassFlow = reader.getDouble();
+    heatLoss.percentHeatLoss = reader.getDouble();
+    heatLoss.inletProperties = reader.getFluidProperties();
+    heatLoss.inletEnergyFlow = reader.getDouble();
+    heatLoss.outletEnergyFlow = reader.getDouble();
+    heatLoss.outletProperties = reader.getFluidProperties();
+    heatLoss.heatLoss = reader.getDouble();
+    heatLoss.quantityType = reader.getEnum<SteamProperties::ThermodynamicQuantity>();
+    return heatLoss;
+}
+
+void SteamModelerSerializer::write(Writer &writer, const HighPressureHeaderCalculationsDomain &domain) const {
+    writer.put(domain.highPressureHeaderOutput);
+    write(writer, domain.highPressureHeaderHeatLoss);
+    writer.put(domain.highPressureCondensate);
+    write(writer, domain.highPressureCondensateFlashTank);
+    write(writer, domain.condensingTurbine);
+    write(writer, domain.condensingTurbineIdeal);
+    write(writer, domain.highToMediumPressureTurbine);
+    write(writer, domain.highToMediumPressureTurbineIdeal);
+    write(writer, domain.highToLowPressureTurbine);
+    write(writer, domain.highToLowPressureTurbineIdeal);
+}
+
+HighPressureHeaderCalculationsDomain SteamModelerSerializer::readHighPressureHeader(Reader &reader) const {
+    const SteamSystemModelerTool::FluidProperties &highPressureHeaderOutput = reader.getFluidProperties();
+    const HeatLoss &highPressureHeaderHeatLoss = readHeatLoss(reader);
+    const SteamSystemModelerTool::FluidProperties &highPressureCondensate = reader.getFluidProperties();
+    const std::shared_ptr<FlashTank> &highPressureCondensateFlashTank = readFlashTank(reader);
+    const std::shared_ptr<Turbine> &condensingTurbine = readTurbine(reader);
+    const std::shared_ptr<Turbine> &condensingTurbineIdeal = readTurbine(reader);
+    const std::shared_ptr<Turbine> &highToMediumPressureTurbine = readTurbine(reader);
+    const std::shared_ptr<Turbine> &highToMediumPressureTurbineIdeal = readTurbine(reader);
+    const std::shared_ptr<Turbine> &highToLowPressureTurbine = readTurbine(reader);
+    const std::shared_ptr<Turbine> &highToLowPressureTurbineIdeal = readTurbine(reader);
+
+    return {highPressureHeaderOutput, highPressureHeaderHeatLoss, highPressureCondensate,
+            highPressureCondensateFlashTank, condensingTurbine, condensingTurbineIdeal, highToMediumPressureTurbine,
+            highToMediumPressureTurbineIdeal, highToLowPressureTurbine, highToLowPressureTurbineIdeal};
+}
+
+void SteamModelerSerializer::write(Writer &writer,
+                                   const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &domain) const {
+    if (writer.putPresent(domain)) {
+        write(writer, domain->highToMediumPressurePrv);
+        write(writer, domain->highPressureCondensateFlashTank);
+        write(writer, domain->mediumPressureHeaderHeatLoss);
+        writer.put(domain->mediumPressureHeaderOutput);
+        writer.put(domain->mediumPressureCondensate);
+        write(writer, domain->mediumToLowPressureTurbine);
+        write(writer, domain->mediumToLowPressureTurbineIdeal);
+        write(writer, domain->highToLowPressureTurbineUpdated);
+        write(writer, domain->highToLowPressureTurbineIdealUpdated);
+    }
+}
+
+std::shared_ptr<MediumPressureHeaderCalculationsDomain>
+SteamModelerSerializer::readMediumPressureHeader(Reader &reader) const {
+    if (!reader.getBool()) return nullptr;
+
+    const std::shared_ptr<PrvWithoutDesuperheating> &highToMediumPressurePrv = readPrv(reader);
+    const std::shared_ptr<FlashTank> &highPressureCondensateFlashTank = readFlashTank(reader);
+    const HeatLoss &mediumPressureHeaderHeatLoss = readHeatLoss(reader);
+    const SteamSystemModelerTool::FluidProperties &mediumPressureHeaderOutput = reader.getFluidProperties();
+    const SteamSystemModelerTool::FluidProperties &mediumPressureCondensate = reader.getFluidProperties();
+    const std::shared_ptr<Turbine> &mediumToLowPressureTurbine = readTurbine(reader);
+    const std::shared_ptr<Turbine> &mediumToLowPressureTurbineIdeal = readTurbine(reader);
+    const std::shared_ptr<Turbine> &highToLowPressureTurbineUpdated = readTurbine(reader);
+    const std::shared_ptr<Turbine> &highToLowPressureTurbineIdealUpdated = readTurbine(reader);
+
+    return std::make_shared<MediumPressureHeaderCalculationsDomain>(MediumPressureHeaderCalculationsDomain{
+            highToMediumPressurePrv, highPressureCondensateFlashTank, mediumPressureHeaderHeatLoss,
+            mediumPressureHeaderOutput, mediumPressureCondensate, mediumToLowPressureTurbine,
+            mediumToLowPressureTurbineIdeal, highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated});
+}
+
+void SteamModelerSerializer::write(Writer &writer,
+                                   const std::shared_ptr<LowPressureHeaderCalculationsDomain> &domain) const {
+    if (writer.putPresent(domain)) {
+        write(writer, domain->lowPressurePrv);
+        writer.put(domain->lowPressureHeaderOutput);
+        write(writer, domain->lowPressureHeaderHeatLoss);
+        writer.put(domain->lowPressureCondensate);
+        const LowPressureFlashedSteamIntoHeaderCalculatorDomain &flashedSteam =
+                domain->lowPressureFlashedSteamIntoHeaderCalculatorDomain;
+        write(writer, flashedSteam.mediumPressureCondensateFlashTank);
+        write(writer, flashedSteam.highPressureCondensateFlashTank);
+    }
+}
+
+std::shared_ptr<LowPressureHeaderCalculationsDomain>
+SteamModelerSerializer::readLowPressureHeader(Reader &reader) const {
+    if (!reader.getBool()) return nullptr;
+
+    const std::shared_ptr<PrvWithoutDesuperheating> &lowPressurePrv = readPrv(reader);
+    const SteamSystemModelerTool::FluidProperties &lowPressureHeaderOutput = reader.getFluidProperties();
+    const HeatLoss &lowPressureHeaderHeatLoss = readHeatLoss(reader);
+    const SteamSystemModelerTool::FluidProperties &lowPressureCondensate = reader.getFluidProperties();
+    const std::shared_ptr<FlashTank> &mediumPressureCondensateFlashTank = readFlashTank(reader);
+    const std::shared_ptr<FlashTank> &highPressureCondensateFlashTank = readFlashTank(reader);
+
+    return std::make_shared<LowPressureHeaderCalculationsDomain>(LowPressureHeaderCalculationsDomain{
+            lowPressurePrv, lowPressureHeaderOutput, lowPressureHeaderHeatLoss, lowPressureCondensate,
+            {mediumPressureCondensateFlashTank, highPressureCondensateFlashTank}});
+}
+
+void SteamModelerSerializer::write(Writer &writer, const MakeupWaterAndCondensateHeaderCalculationsDomain &domain) const {
+    writer.put(domain.combinedCondensate);
+    writer.put(domain.returnCondensate);
+    write(writer, domain.returnCondensateCalculationsDomain.condensateFlashTank);
+    writer.put(domain.returnCondensateCalculationsDomain.returnCondensateFlashed);
+    writer.put(domain.makeupWater);
+    writer.put(domain.makeupWaterVolumeFlowCalculationsDomain.makeupWaterVolumeFlow);
+    writer.put(domain.makeupWaterVolumeFlowCalculationsDomain.makeupWaterVolumeFlowAnnual);
+    if (writer.putPresent(domain.heatExchangerOutput)) {
+        writer.put(domain.heatExchangerOutput->hotOutlet);
+        writer.put(domain.heatExchangerOutput->coldOutlet);
+    }
+    writer.put(domain.makeupWaterAndCondensateHeaderOutput);
+}
+
+MakeupWaterAndCondensateHeaderCalculationsDomain
+SteamModelerSerializer::readMakeupWaterAndCondensateHeader(Reader &reader) const {
+    const SteamSystemModelerTool::FluidProperties &combinedCondensate = reader.getFluidProperties();
+    const SteamSystemModelerTool::FluidProperties &returnCondensate = reader.getFluidProperties();
+    const std::shared_ptr<FlashTank> &condensateFlashTank = readFlashTank(reader);
+    const SteamSystemModelerTool::FluidProperties &returnCondensateFlashed = reader.getFluidProperties();
+    const SteamSystemModelerTool::FluidProperties &makeupWater = reader.getFluidProperties();
+    const double makeupWaterVolumeFlow = reader.getDouble();
+    const double makeupWaterVolumeFlowAnnual = reader.getDouble();
+    std::shared_ptr<HeatExchanger::Output> heatExchangerOutput = nullptr;
+    if (reader.getBool()) {
+        const SteamSystemModelerTool::FluidProperties &hotOutlet = reader.getFluidProperties();
+        const SteamSystemModelerTool::FluidProperties &coldOutlet = reader.getFluidProperties();
+        heatExchangerOutput = std::make_shared<HeatExchanger::Output>(hotOutlet, coldOutlet);
+    }
+    const SteamSystemModelerTool::FluidProperties &makeupWaterAndCondensateHeaderOutput = reader.getFluidProperties();
+
+    return {combinedCondensate, returnCondensate, {condensateFlashTank, returnCondensateFlashed}, makeupWater,
+            {makeupWaterVolumeFlow, makeupWaterVolumeFlowAnnual}, heatExchangerOutput,
+            makeupWaterAndCondensateHeaderOutput};
+}
+
+void SteamModelerSerializer::write(Writer &writer, const PowerBalanceCheckerCalculationsDomain &domain) const {
+    writer.put(domain.steamBalance);
+    const std::shared_ptr<LowPressureVentedSteamCalculationsDomain> &ventedSteam =
+            domain.lowPressureVentedSteamCalculationsDomain;
+    if (writer.putPresent(ventedSteam)) {
+        writer.put(ventedSteam->lowPressureVentedSteam);
+        writer.put(ventedSteam->makeupWater);
+        writer.put(ventedSteam->makeupWaterAndCondensateHeaderOutputUpdated);
+        writer.put(ventedSteam->makeupWaterVolumeFlowCalculationsDomain.makeupWaterVolumeFlow);
+        writer.put(ventedSteam->makeupWaterVolumeFlowCalculationsDomain.makeupWaterVolumeFlowAnnual);
+        write(writer, ventedSteam->deaerator);
+    }
+    if (writer.putPresent(domain.lowPressureVentedSteam)) {
+        writer.put(*domain.lowPressureVentedSteam);
+    }
+}
+
+PowerBalanceCheckerCalculationsDomain SteamModelerSerializer::readPowerBalanceChecker(Reader &reader) const {
+    const double steamBalance = reader.getDouble();
+    std::shared_ptr<LowPressureVentedSteamCalculationsDomain> ventedSteamDomain = nullptr;
+    if (reader.getBool()) {
+        const double lowPressureVentedSteam = reader.getDouble();
+        const SteamSystemModelerTool::FluidProperties &makeupWater = reader.getFluidProperties();
+        const SteamSystemModelerTool::FluidProperties &headerOutputUpdated = reader.getFluidProperties();
+        const double makeupWaterVolumeFlow = reader.getDouble();
+        const double makeupWaterVolumeFlowAnnual = reader.getDouble();
+        const Deaerator &deaerator = readDeaerator(reader);
+        ventedSteamDomain = std::make_shared<LowPressureVentedSteamCalculationsDomain>(
+                LowPressureVentedSteamCalculationsDomain{lowPressureVentedSteam, makeupWater, headerOutputUpdated,
+                                                         {makeupWaterVolumeFlow, makeupWaterVolumeFlowAnnual},
+                                                         deaerator});
+    }
+    std::shared_ptr<SteamSystemModelerTool::FluidProperties> lowPressureVentedSteam = nullptr;
+    if (reader.getBool()) {
+        lowPressureVentedSteam = std::make_shared<SteamSystemModelerTool::FluidProperties>(reader.getFluidProperties());
+    }
+
+    return {steamBalance, ventedSteamDomain, lowPressureVentedSteam};
+}
+
+void SteamModelerSerializer::write(Writer &writer, const ProcessSteamUsageCalculationsDomain &domain) const {
+    const auto writeUsage = [&writer](const ProcessSteamUsage &usage) {
+        writer.put(usage.pressure);
+        writer.put(usage.temperature);
+        writer.put(usage.energyFlow);
+        writer.put(usage.massFlow);
+        writer.put(usage.processUsage);
+    };
+
+    writeUsage(domain.highPressureProcessSteamUsage);
+    for (const auto &usage : {domain.lowPressureProcessUsagePtr, domain.mediumPressureProcessUsagePtr}) {
+        if (writer.putPresent(usage)) writeUsage(*usage);
+    }
+}
+
+ProcessSteamUsageCalculationsDomain SteamModelerSerializer::readProcessSteamUsage(Reader &reader) const {
+    const auto readUsage = [&reader]() {
+        const double pressure = reader.getDouble();
+        const double temperature = reader.getDouble();
+        const double energyFlow = reader.getDouble();
+        const double massFlow = reader.getDouble();
+        const double processUsage = reader.getDouble();
+        return ProcessSteamUsage{pressure, temperature, energyFlow, massFlow, processUsage};
+    };
+
+    const ProcessSteamUsage highPressureProcessSteamUsage = readUsage();
+    std::shared_ptr<ProcessSteamUsage> lowPressureProcessUsagePtr = nullptr;
+    if (reader.getBool()) lowPressureProcessUsagePtr = std::make_shared<ProcessSteamUsage>(readUsage());
+    std::shared_ptr<ProcessSteamUsage> mediumPressureProcessUsagePtr = nullptr;
+    if (reader.getBool()) mediumPressureProcessUsagePtr = std::make_shared<ProcessSteamUsage>(readUsage());
+
+    return {highPressureProcessSteamUsage, lowPressureProcessUsagePtr, mediumPressureProcessUsagePtr};
+}
+
+void SteamModelerSerializer::write(Writer &writer, const EnergyAndCostCalculationsDomain &domain) const {
+    writer.put(domain.powerGenerated);
+    writer.put(domain.sitePowerImport);
+    writer.put(domain.powerDemand);
+    writer.put(domain.powerGenerationCost);
+    writer.put(domain.boilerFuelCost);
+    writer.put(domain.makeupWaterCost);
+    writer.put(domain.totalOperatingCost);
+    writer.put(domain.boilerFuelUsage);
+}
+
+EnergyAndCostCalculationsDomain SteamModelerSerializer::readEnergyAndCost(Reader &reader) const {
+    const double powerGenerated = reader.getDouble();
+    const double sitePowerImport = reader.getDouble();
+    const double powerDemand = reader.getDouble();
+    const double powerGenerationCost = reader.getDouble();
+    const double boilerFuelCost = reader.getDouble();
+    const double makeupWaterCost = reader.getDouble();
+    const double totalOperatingCost = reader.getDouble();
+    const double boilerFuelUsage = reader.getDouble();
+
+    return {powerGenerated, sitePowerImport, powerDemand, powerGenerationCost, boilerFuelCost, makeupWaterCost,
+            totalOperatingCost, boilerFuelUsage};
+}
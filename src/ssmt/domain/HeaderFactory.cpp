@@ -381,7 +381,8 @@ HeaderFactory::make(const double headerPressure, const SteamSystemModelerTool::F
     // std::cout << methodName << "making header" << std::endl;
 
     // std::cout << methodName << "adding returnCondensate inlet" << std::endl;
-    const Inlet &returnCondensateInlet = inletFactory.makeWithEnthalpy(returnCondensate);
+    // the return condensate and makeup water states are already calculated, share them instead of re-evaluating
+    const Inlet &returnCondensateInlet = inletFactory.makeWithProperties(returnCondensate);
 
     std::vector<Inlet> inlets = {returnCondensateInlet};
 
@@ -397,7 +398,7 @@ HeaderFactory::make(const double headerPressure, const SteamSystemModelerTool::F
     } else {
         // std::cout << methodName << "isPreheatMakeupWater is false, adding makeupWater inlet" << std::endl;
 
-        const Inlet &makeupWaterInlet = inletFactory.makeWithEnthalpy(makeupWater);
+        const Inlet &makeupWaterInlet = inletFactory.makeWithProperties(makeupWater);
         inlets.push_back(makeupWaterInlet);
     }
 
@@ -1,19 +1,22 @@
 #include "ssmt/domain/HeatLossFactory.h"
 
 const HeatLoss HeatLossFactory::make(const HeaderWithHighestPressure &highestPressureHeaderInput,
-                                     const SteamSystemModelerTool::FluidProperties &headerOutput) const {
+                                     const SteamSystemModelerTool::FluidProperties &headerOutput,
+                                     const std::shared_ptr<HeatLoss> &previousHeatLoss) const {
     double percentHeatLoss = highestPressureHeaderInput.getHeatLoss();
-    return make(headerOutput, percentHeatLoss);
+    return make(headerOutput, percentHeatLoss, previousHeatLoss);
 }
 
 const HeatLoss HeatLossFactory::make(const std::shared_ptr<HeaderNotHighestPressure> &notHighestPressureHeaderInput,
-                                     const SteamSystemModelerTool::FluidProperties &headerOutput) const {
+                                     const SteamSystemModelerTool::FluidProperties &headerOutput,
+                                     const std::shared_ptr<HeatLoss> &previousHeatLoss) const {
     double percentHeatLoss = notHighestPressureHeaderInput->getHeatLoss();
-    return make(headerOutput, percentHeatLoss);
+    return make(headerOutput, percentHeatLoss, previousHeatLoss);
 }
 
 const HeatLoss
-HeatLossFactory::make(const SteamSystemModelerTool::FluidProperties &headerOutput, const double percentHeatLoss) const {
+HeatLossFactory::make(const SteamSystemModelerTool::FluidProperties &headerOutput, const double percentHeatLoss,
+                      const std::shared_ptr<HeatLoss> &previousHeatLoss) const {
     const std::string methodName = "HeatLossFactory::" + std::string(__func__) + ": ";
 
     double inletPressure = headerOutput.pressure;
@@ -21,7 +24,10 @@ HeatLossFactory::make(const SteamSystemModelerTool::FluidProperties &headerOutpu
     double quantityValue = headerOutput.specificEnthalpy;
     double inletMassFlow = headerOutput.massFlow;
 
-    HeatLoss heatLoss = {inletPressure, quantityType, quantityValue, inletMassFlow, percentHeatLoss};
+    HeatLoss heatLoss = previousHeatLoss
+                        ? HeatLoss(*previousHeatLoss, inletPressure, quantityType, quantityValue, inletMassFlow,
+                                   percentHeatLoss)
+                        : HeatLoss(inletPressure, quantityType, quantityValue, inletMassFlow, percentHeatLoss);
 
     //std::cout << methodName << "heatLoss=" << heatLoss << std::endl;
 
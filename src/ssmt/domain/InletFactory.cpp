@@ -95,6 +95,10 @@ Inlet InletFactory::makeWithEnthalpy(const SteamSystemModelerTool::FluidProperti
     return inlet;
 }
 
+Inlet InletFactory::makeWithProperties(const SteamSystemModelerTool::FluidProperties &properties) const {
+    return {properties, properties.massFlow};
+}
+
 Inlet InletFactory::makeWithTemperature(const std::shared_ptr<HeatExchanger::Output> &output) const {
     const std::string methodName = std::string("InletFactory::") + std::string(__func__) + ": ";
 
@@ -5,7 +5,8 @@ DeaeratorModeler::model(const int headerCountInput, const BoilerInput &boilerInp
                         const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
                         const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
                         const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
-                        const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain) const {
+                        const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
+                        const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const {
     const std::string methodName = std::string("DeaeratorModeler::") + std::string(__func__) + ": ";
 
     // std::cout << methodName << "calculating deaerator" << std::endl;
@@ -16,7 +17,7 @@ DeaeratorModeler::model(const int headerCountInput, const BoilerInput &boilerInp
     const Deaerator &deaerator =
             makeDeaerator(headerCountInput, boilerInput, highPressureHeaderCalculationsDomain,
                           lowPressureHeaderCalculationsDomain, makeupWaterAndCondensateHeaderCalculationsDomain,
-                          feedwaterMassFlow);
+                          feedwaterMassFlow, deaeratorSaturatedProperties);
 
     return deaerator;
 }
@@ -79,7 +80,8 @@ Deaerator DeaeratorModeler::makeDeaerator(const int headerCountInput, const Boil
                                           const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
                                           const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
                                           const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
-                                          const double feedwaterMassFlow) const {
+                                          const double feedwaterMassFlow,
+                                          const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const {
     const std::string methodName = std::string("DeaeratorModeler::") + std::string(__func__) + ": ";
 
 
@@ -92,6 +94,6 @@ Deaerator DeaeratorModeler::makeDeaerator(const int headerCountInput, const Boil
             headerCountInput == 1 ? highPressureHeaderCalculationsDomain.highPressureHeaderOutput
                                   : lowPressureHeaderCalculationsDomain->lowPressureHeaderOutput;
 
-    return deaeratorFactory.make(boilerInput, feedwaterMassFlow, makeupWaterAndCondensateHeaderOutput,
-                                 inletHeaderOutput);
+    return deaeratorFactory.make(boilerInput, feedwaterMassFlow, deaeratorSaturatedProperties,
+                                 makeupWaterAndCondensateHeaderOutput, inletHeaderOutput);
 }
@@ -17,7 +17,8 @@ void RestarterService::restartIfNotEnoughSteam(const std::shared_ptr<Turbine> &t
     restartIfNotEnoughSteam(additionalSteamNeeded, boiler);
 }
 
-void RestarterService::restartIfNotEnoughSteam(const double additionalSteamNeeded, const Boiler &boiler) const {
+void RestarterService::restartIfNotEnoughSteam(const double additionalSteamNeeded, const Boiler &boiler,
+                                               const SteamReductionBranch reductionBranch) const {
     const std::string methodName = std::string("RestarterService::") + std::string(__func__) + "(steamNeed, boiler): ";
 
     if (std::isnan(additionalSteamNeeded)) {
@@ -47,7 +48,7 @@ void RestarterService::restartIfNotEnoughSteam(const double additionalSteamNeede
         logMessage("steamMassFlow=" + std::to_string(steamMassFlow) + ", additionalSteamNeeded=" +
                    std::to_string(additionalSteamNeeded) + ", adjustedSteam=" +
                    std::to_string(adjustedSteam));
-        throw SteamBalanceException(additionalSteamNeeded, adjustedSteam);
+        throw SteamBalanceException(additionalSteamNeeded, adjustedSteam, reductionBranch);
     } else {
         logMessage(
                 "additionalSteamNeeded=" + std::to_string(additionalSteamNeeded) + " is within tolerance=" +
@@ -0,0 +1,15 @@
+#include "ssmt/service/SteamBalanceConvergenceException.h"
+
+SteamBalanceConvergenceException::SteamBalanceConvergenceException(const std::string &message,
+                                                                   const SteamBalanceTrace &trace)
+        : std::logic_error(message), trace(trace) {}
+
+std::ostream &operator<<(std::ostream &stream, const SteamBalanceConvergenceException &e) {
+    return stream << "SteamBalanceConvergenceException["
+                  << "message=" << e.what()
+                  << ", trace=" << e.getTrace() << "]";
+}
+
+const SteamBalanceTrace &SteamBalanceConvergenceException::getTrace() const {
+    return trace;
+}
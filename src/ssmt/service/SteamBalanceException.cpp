@@ -1,12 +1,15 @@
 #include "ssmt/service/SteamBalanceException.h"
 
-SteamBalanceException::SteamBalanceException(double additionalSteamNeeded, double adjustedInitialSteam)
-        : additionalSteamNeeded(additionalSteamNeeded), adjustedInitialSteam(adjustedInitialSteam) {}
+SteamBalanceException::SteamBalanceException(double additionalSteamNeeded, double adjustedInitialSteam,
+                                             SteamReductionBranch reductionBranch)
+        : additionalSteamNeeded(additionalSteamNeeded), adjustedInitialSteam(adjustedInitialSteam),
+          reductionBranch(reductionBranch) {}
 
 std::ostream &operator<<(std::ostream &stream, const SteamBalanceException &e) {
     return stream << "SteamBalanceException["
                   << "additionalSteamNeeded=" << e.getAdditionalSteamNeeded()
-                  << ", adjustedInitialSteam=" << e.getAdjustedInitialSteam() << "]";
+                  << ", adjustedInitialSteam=" << e.getAdjustedInitialSteam()
+                  << ", reductionBranch=" << toString(e.getReductionBranch()) << "]";
 }
 
 double SteamBalanceException::getAdditionalSteamNeeded() const {
@@ -16,3 +19,7 @@ double SteamBalanceException::getAdditionalSteamNeeded() const {
 double SteamBalanceException::getAdjustedInitialSteam() const {
     return adjustedInitialSteam;
 }
+
+SteamReductionBranch SteamBalanceException::getReductionBranch() const {
+    return reductionBranch;
+}
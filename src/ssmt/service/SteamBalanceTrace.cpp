@@ -0,0 +1,68 @@
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include "ssmt/service/SteamBalanceTrace.h"
+
+std::string toString(const SteamReductionBranch reductionBranch) {
+    switch (reductionBranch) {
+        case SteamReductionBranch::NOT_REDUCED:
+            return "NOT_REDUCED";
+        case SteamReductionBranch::BALANCE_HEADER:
+            return "BALANCE_HEADER";
+        case SteamReductionBranch::POWER_RANGE:
+            return "POWER_RANGE";
+        case SteamReductionBranch::FLOW_RANGE:
+            return "FLOW_RANGE";
+    }
+    return "UNKNOWN";
+}
+
+std::ostream &operator<<(std::ostream &stream, const SteamBalanceIteration &iteration) {
+    return stream << "SteamBalanceIteration["
+                  << "iteration=" << iteration.iteration
+                  << ", initialMassFlow=" << iteration.initialMassFlow
+                  << ", balanced=" << iteration.balanced
+                  << ", additionalSteamNeeded=" << iteration.additionalSteamNeeded
+                  << ", adjustedInitialSteam=" << iteration.adjustedInitialSteam
+                  << ", reductionBranch=" << toString(iteration.reductionBranch) << "]";
+}
+
+const std::vector<SteamBalanceIteration> &SteamBalanceTrace::getIterations() const {
+    return iterations;
+}
+
+std::size_t SteamBalanceTrace::getIterationCount() const {
+    return iterations.size();
+}
+
+bool SteamBalanceTrace::isBalanced() const {
+    return !iterations.empty() && iterations.back().balanced;
+}
+
+void SteamBalanceTrace::add(const SteamBalanceIteration &iteration) {
+    iterations.push_back(iteration);
+}
+
+void SteamBalanceTrace::clear() {
+    iterations.clear();
+}
+
+std::string SteamBalanceTrace::toCsv() const {
+    std::ostringstream csv;
+    csv << std::setprecision(std::numeric_limits<double>::max_digits10);
+    csv << "iteration,initialMassFlow,balanced,additionalSteamNeeded,adjustedInitialSteam,reductionBranch\n";
+    for (const SteamBalanceIteration &iteration : iterations) {
+        csv << iteration.iteration << ',' << iteration.initialMassFlow << ',' << iteration.balanced << ','
+            << iteration.additionalSteamNeeded << ',' << iteration.adjustedInitialSteam << ','
+            << toString(iteration.reductionBranch) << '\n';
+    }
+    return csv.str();
+}
+
+std::ostream &operator<<(std::ostream &stream, const SteamBalanceTrace &trace) {
+    stream << "SteamBalanceTrace[";
+    for (std::size_t i = 0; i < trace.iterations.size(); i++) {
+        stream << (i == 0 ? "" : ", ") << trace.iterations[i];
+    }
+    return stream << "]";
+}
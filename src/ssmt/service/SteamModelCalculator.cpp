@@ -3,7 +3,8 @@
 SteamModelCalculationsDomain
 SteamModelCalculator::calc(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
                            const BoilerInput &boilerInput, const TurbineInput &turbineInput,
-                           const OperationsInput &operationsInput, const double initialMassFlow) const {
+                           const OperationsInput &operationsInput, const double initialMassFlow,
+                           SteamModelRunDomain &runDomain) const {
     const std::string methodName = "SteamModelCalculator::" + std::string(__func__) + ": ";
 
     const HeaderWithHighestPressure &highPressureHeaderInput = headerInput.getHighPressureHeader();
@@ -28,7 +29,9 @@ SteamModelCalculator::calc(const bool isBaselineCalc, const double baselinePower
     HighPressureHeaderCalculationsDomain highPressureHeaderCalculationsDomain =
             highPressureHeaderModeler.model(headerCountInput, highPressureHeaderInput, mediumPressureHeaderInput,
                                             lowPressureHeaderInput, highToMediumTurbineInput, highToLowTurbineInput,
-                                            condensingTurbineInput, boiler);
+                                            condensingTurbineInput, boiler, runDomain.highPressureHeaderHeatLoss);
+    runDomain.highPressureHeaderHeatLoss =
+            std::make_shared<HeatLoss>(highPressureHeaderCalculationsDomain.highPressureHeaderHeatLoss);
 //     std::cout << methodName << "highPressureHeaderCalculationsDomain=" << highPressureHeaderCalculationsDomain
              // << std::endl;
 
@@ -37,7 +40,12 @@ SteamModelCalculator::calc(const bool isBaselineCalc, const double baselinePower
             mediumPressureHeaderModeler.model(headerCountInput, highPressureHeaderInput, mediumPressureHeaderInput,
                                               lowPressureHeaderInput, highToMediumTurbineInput, highToLowTurbineInput,
                                               mediumToLowTurbineInput, condensingTurbineInput, boiler,
-                                              highPressureHeaderCalculationsDomain);
+                                              highPressureHeaderCalculationsDomain,
+                                              runDomain.mediumPressureHeaderHeatLoss);
+    if (mediumPressureHeaderCalculationsDomain != nullptr) {
+        runDomain.mediumPressureHeaderHeatLoss =
+                std::make_shared<HeatLoss>(mediumPressureHeaderCalculationsDomain->mediumPressureHeaderHeatLoss);
+    }
 //     std::cout << methodName << "mediumPressureHeaderCalculationsDomain=" << mediumPressureHeaderCalculationsDomain
             //  << std::endl;
 
@@ -47,7 +55,12 @@ SteamModelCalculator::calc(const bool isBaselineCalc, const double baselinePower
                                            lowPressureHeaderInput, highToLowTurbineInput, mediumToLowTurbineInput,
                                            condensingTurbineInput, boilerInput, boiler, blowdownFlashTank,
                                            highPressureHeaderCalculationsDomain,
-                                           mediumPressureHeaderCalculationsDomain);
+                                           mediumPressureHeaderCalculationsDomain,
+                                           runDomain.lowPressureHeaderHeatLoss);
+    if (lowPressureHeaderCalculationsDomain != nullptr) {
+        runDomain.lowPressureHeaderHeatLoss =
+                std::make_shared<HeatLoss>(lowPressureHeaderCalculationsDomain->lowPressureHeaderHeatLoss);
+    }
 //     std::cout << methodName << "lowPressureHeaderCalculationsDomain=" << lowPressureHeaderCalculationsDomain
            //   << std::endl;
 
@@ -58,7 +71,7 @@ SteamModelCalculator::calc(const bool isBaselineCalc, const double baselinePower
                                                         operationsInput, condensingTurbineInput, boiler,
                                                         blowdownFlashTank, highPressureHeaderCalculationsDomain,
                                                         mediumPressureHeaderCalculationsDomain,
-                                                        lowPressureHeaderCalculationsDomain);
+                                                        lowPressureHeaderCalculationsDomain, runDomain.makeupWater);
 //     std::cout << methodName << "makeupWaterAndCondensateHeaderCalculationsDomain="
             //  << makeupWaterAndCondensateHeaderCalculationsDomain << std::endl;
 
@@ -66,7 +79,8 @@ SteamModelCalculator::calc(const bool isBaselineCalc, const double baselinePower
     Deaerator deaerator =
             deaeratorModeler.model(headerCountInput, boilerInput, boiler, highPressureHeaderCalculationsDomain,
                                    mediumPressureHeaderCalculationsDomain, lowPressureHeaderCalculationsDomain,
-                                   makeupWaterAndCondensateHeaderCalculationsDomain);
+                                   makeupWaterAndCondensateHeaderCalculationsDomain,
+                                   runDomain.deaeratorSaturatedProperties);
 //     std::cout << methodName << "deaerator=" << deaerator << std::endl;
 
 //     std::cout << methodName << "running powerBalanceChecker" << std::endl;
@@ -78,7 +92,8 @@ SteamModelCalculator::calc(const bool isBaselineCalc, const double baselinePower
                                       boiler, blowdownFlashTank, deaeratorInletSteamMassFlow,
                                       highPressureHeaderCalculationsDomain, mediumPressureHeaderCalculationsDomain,
                                       lowPressureHeaderCalculationsDomain,
-                                      makeupWaterAndCondensateHeaderCalculationsDomain);
+                                      makeupWaterAndCondensateHeaderCalculationsDomain,
+                                      runDomain.deaeratorSaturatedProperties);
 //     std::cout << methodName << "powerBalanceCheckerCalculationsDomain=" << powerBalanceCheckerCalculationsDomain
             //  << std::endl;
 
@@ -4,12 +4,26 @@ SteamModelCalculationsDomain
 SteamModelRunner::run(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
                       const BoilerInput &boilerInput, const TurbineInput &turbineInput,
                       const OperationsInput &operationsInput) const {
+    SteamBalanceTrace trace;
+    return run(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput, turbineInput, operationsInput, trace);
+}
+
+SteamModelCalculationsDomain
+SteamModelRunner::run(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
+                      const BoilerInput &boilerInput, const TurbineInput &turbineInput,
+                      const OperationsInput &operationsInput, SteamBalanceTrace &trace) const {
     const std::string methodName = std::string("SteamModelRunner::") + std::string(__func__) + ": ";
 
     // adjust max iterations as desired; mainly to prevent runaway modeling from unexpected issues
     const int maxIterationCount = 25;
 
+    trace.clear();
+
     double initialMassFlow = massFlowCalculator.calcInitialMassFlow(headerInput);
+    // shared by, and carried from each restart iteration to the next
+    SteamModelRunDomain runDomain;
+    runDomain.makeupWater = makeupWaterCalculator.calc(operationsInput);
+    runDomain.deaeratorSaturatedProperties = deaeratorFactory.makeSaturatedProperties(boilerInput);
 
     int iterationCount = 0;
     while (iterationCount < maxIterationCount) {
@@ -17,24 +31,29 @@ SteamModelRunner::run(const bool isBaselineCalc, const double baselinePowerDeman
         logSection(methodName + "iterationCount=" + std::to_string(iterationCount));
 
         try {
-            return steamModelCalculator.calc(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput,
-                                             turbineInput, operationsInput, initialMassFlow);
+            const SteamModelCalculationsDomain &steamModelCalculationsDomain =
+                    steamModelCalculator.calc(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput,
+                                              turbineInput, operationsInput, initialMassFlow, runDomain);
+            trace.add({iterationCount, initialMassFlow, true, 0, 0, SteamReductionBranch::NOT_REDUCED});
+            return steamModelCalculationsDomain;
         } catch (const SteamBalanceException &e) {
-            initialMassFlow = handleSteamBalanceException(e, iterationCount, initialMassFlow);
+            initialMassFlow = handleSteamBalanceException(e, iterationCount, initialMassFlow, trace);
         }
     }
 
     std::string msg =
             methodName + "ran " + std::to_string(maxIterationCount) + " times and did not balance system, aborting";
     // std::cout << msg << std::endl;
-    throw std::logic_error(msg);
+    throw SteamBalanceConvergenceException(msg, trace);
 }
 
 double SteamModelRunner::handleSteamBalanceException(const SteamBalanceException &e, const int iterationCount,
-                                                     const double initialMassFlow) const {
+                                                     const double initialMassFlow, SteamBalanceTrace &trace) const {
     const std::string methodName = std::string("SteamModelRunner::") + std::string(__func__) + ": ";
 
     const double adjustedInitialSteam = e.getAdjustedInitialSteam();
+    trace.add({iterationCount, initialMassFlow, false, e.getAdditionalSteamNeeded(), adjustedInitialSteam,
+               e.getReductionBranch()});
     // std::cout << methodName << e << std::endl;
     // std::cout << methodName << "iterationCount=" << iterationCount
             //   << " with initialMassFlow=" << initialMassFlow
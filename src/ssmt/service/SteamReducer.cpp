@@ -32,12 +32,14 @@ SteamReducer::reduceSteamThroughHighToLowTurbine(const double additionalSteamNee
             case PressureTurbineOperation::POWER_GENERATION:
                 // std::cout << methodName << "pressureTurbineOperation is POWER_GENERATION,"
                 //          << " skipping reducing as fixed steam cannot reduce steam through turbine" << std::endl;
-                steamReducerOutput = {additionalSteamNeeded, highToLowPressureTurbine, highToLowPressureTurbineIdeal};
+                steamReducerOutput = {additionalSteamNeeded, highToLowPressureTurbine, highToLowPressureTurbineIdeal,
+                              SteamReductionBranch::NOT_REDUCED};
                 break;
             case PressureTurbineOperation::STEAM_FLOW:
                 // std::cout << methodName << "pressureTurbineOperation is STEAM_FLOW,"
                 //          << " skipping reducing as fixed steam cannot reduce steam through turbine" << std::endl;
-                steamReducerOutput = {additionalSteamNeeded, highToLowPressureTurbine, highToLowPressureTurbineIdeal};
+                steamReducerOutput = {additionalSteamNeeded, highToLowPressureTurbine, highToLowPressureTurbineIdeal,
+                              SteamReductionBranch::NOT_REDUCED};
                 break;
             case PressureTurbineOperation::BALANCE_HEADER:
                 steamReducerOutput =
@@ -52,7 +54,8 @@ SteamReducer::reduceSteamThroughHighToLowTurbine(const double additionalSteamNee
         }
     } else {
         // std::cout << methodName << "high to low turbine not provided, skipping reducing" << std::endl;
-        steamReducerOutput = {additionalSteamNeeded, highToLowPressureTurbine, highToLowPressureTurbineIdeal};
+        steamReducerOutput = {additionalSteamNeeded, highToLowPressureTurbine, highToLowPressureTurbineIdeal,
+                              SteamReductionBranch::NOT_REDUCED};
     }
 
     // std::cout << methodName
@@ -109,7 +112,8 @@ SteamReducer::reduceBalanceHeader(const double additionalSteamNeeded,
     // std::cout << methodName << "highToLowPressureTurbineIdealUpdated=" << highToLowPressureTurbineIdealUpdated
             //  << std::endl;
 
-    return {remainingAdditionalSteamNeeded, highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated};
+    return {remainingAdditionalSteamNeeded, highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated,
+            SteamReductionBranch::BALANCE_HEADER};
 }
 
 SteamReducerOutput
@@ -188,7 +192,8 @@ SteamReducer::reducePowerRange(const double additionalSteamNeeded,
         remainingAdditionalSteamNeeded = additionalSteamNeeded;
     }
 
-    return {remainingAdditionalSteamNeeded, highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated};
+    return {remainingAdditionalSteamNeeded, highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated,
+            SteamReductionBranch::POWER_RANGE};
 }
 
 SteamReducerOutput
@@ -264,5 +269,6 @@ SteamReducer::reduceFlowRange(const double additionalSteamNeeded,
         }
     }
 
-    return {remainingAdditionalSteamNeeded, highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated};
+    return {remainingAdditionalSteamNeeded, highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated,
+            SteamReductionBranch::FLOW_RANGE};
 }
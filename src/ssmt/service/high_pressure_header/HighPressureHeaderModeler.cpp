@@ -6,7 +6,8 @@ HighPressureHeaderModeler::model(const int headerCountInput, const HeaderWithHig
                                  const std::shared_ptr<HeaderNotHighestPressure> &lowPressureHeaderInput,
                                  const PressureTurbine &highToMediumTurbineInput,
                                  const PressureTurbine &highToLowTurbineInput,
-                                 const CondensingTurbine &condensingTurbineInput, const Boiler &boiler) const {
+                                 const CondensingTurbine &condensingTurbineInput, const Boiler &boiler,
+                                 const std::shared_ptr<HeatLoss> &previousHeatLoss) const {
     const std::string methodName = std::string("HighPressureHeaderModeler::") + std::string(__func__) + ": ";
 
     //2A. Calculate High Pressure Header
@@ -17,7 +18,8 @@ HighPressureHeaderModeler::model(const int headerCountInput, const HeaderWithHig
 
     //2B. Calculate Heat Loss of steam in high pressure header
 //     std::cout << methodName << "calculating highPressureHeader heat loss" << std::endl;
-    const HeatLoss &heatLoss = heatLossFactory.make(highPressureHeaderInput, highPressureHeaderOutputOriginal);
+    const HeatLoss &heatLoss = heatLossFactory.make(highPressureHeaderInput, highPressureHeaderOutputOriginal,
+                                                    previousHeatLoss);
 //     std::cout << methodName << "highPressureHeader heatLoss=" << heatLoss << std::endl;
 
 //     std::cout << methodName << "updating highPressureHeader with heat loss" << std::endl;
@@ -9,7 +9,8 @@ LowPressureHeaderModeler::model(const int headerCountInput, const HeaderWithHigh
                                 const CondensingTurbine &condensingTurbineInput, const BoilerInput &boilerInput,
                                 const Boiler &boiler, const std::shared_ptr<FlashTank> &blowdownFlashTank,
                                 const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
-                                const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain) const {
+                                const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
+                                const std::shared_ptr<HeatLoss> &previousHeatLoss) const {
     const std::string methodName = std::string("LowPressureHeaderModeler::") + std::string(__func__) + ": ";
 
     //if low pressure header exists
@@ -47,7 +48,7 @@ LowPressureHeaderModeler::model(const int headerCountInput, const HeaderWithHigh
 
         //4D. Calculate Heat Loss for Remaining Steam in Low Pressure Header
         // std::cout << methodName << "calculating lowPressureHeader heat loss" << std::endl;
-        const HeatLoss &heatLoss = heatLossFactory.make(lowPressureHeaderInput, lowPressureHeaderOutput);
+        const HeatLoss &heatLoss = heatLossFactory.make(lowPressureHeaderInput, lowPressureHeaderOutput, previousHeatLoss);
         // std::cout << methodName << "lowPressureHeader heatLoss=" << heatLoss << std::endl;
 
         // std::cout << methodName << "updating lowPressureHeader with heat loss" << std::endl;
@@ -9,7 +9,8 @@ MediumPressureHeaderModeler::model(const int headerCountInput, const HeaderWithH
                                    const PressureTurbine &mediumToLowTurbineInput,
                                    const CondensingTurbine &condensingTurbineInput,
                                    const Boiler &boiler,
-                                   HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain) const {
+                                   HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
+                                   const std::shared_ptr<HeatLoss> &previousHeatLoss) const {
     const std::string methodName = std::string("MediumPressureHeaderModeler::") + std::string(__func__) + ": ";
 
     std::shared_ptr<MediumPressureHeaderCalculationsDomain> mediumPressureHeaderCalculationsDomain = nullptr;
@@ -28,7 +29,7 @@ MediumPressureHeaderModeler::model(const int headerCountInput, const HeaderWithH
                     modelIteration(headerCountInput, highPressureHeaderInput, mediumPressureHeaderInput,
                                    lowPressureHeaderInput, highToMediumTurbineInput, highToLowTurbineInput,
                                    mediumToLowTurbineInput, condensingTurbineInput, boiler,
-                                   highPressureHeaderCalculationsDomain);
+                                   highPressureHeaderCalculationsDomain, previousHeatLoss);
             // no exception means it is balanced (or not in use!)
             isMediumPressureHeaderBalanced = true;
 
@@ -102,7 +103,8 @@ MediumPressureHeaderModeler::modelIteration(const int headerCountInput,
                                             const PressureTurbine &mediumToLowTurbineInput,
                                             const CondensingTurbine &condensingTurbineInput,
                                             const Boiler &boiler,
-                                            const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain) const {
+                                            const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
+                                            const std::shared_ptr<HeatLoss> &previousHeatLoss) const {
     const std::string methodName = std::string("MediumPressureHeaderModeler::") + std::string(__func__) + ": ";
 
     //if medium pressure header exists
@@ -153,7 +155,8 @@ MediumPressureHeaderModeler::modelIteration(const int headerCountInput,
 
         //3C. Calculate Heat Loss for Remaining Steam in Medium Pressure Header
         // std::cout << methodName << "calculating mediumPressureHeader heat loss" << std::endl;
-        const HeatLoss &heatLoss = heatLossFactory.make(mediumPressureHeaderInput, mediumPressureHeaderOutputOriginal);
+        const HeatLoss &heatLoss = heatLossFactory.make(mediumPressureHeaderInput, mediumPressureHeaderOutputOriginal,
+                                                        previousHeatLoss);
         // std::cout << methodName << "mediumPressureHeader heatLoss=" << heatLoss << std::endl;
 
         // std::cout << methodName << "updating mediumPressureHeader with heat loss" << std::endl;
@@ -35,10 +35,10 @@ SteamBalanceCheckerService::check(const std::string &itemName, const PressureTur
             throw ReducedSteamException("Reduced steam from highToLowPressureTurbine for " + itemName,
                                         highToLowPressureTurbineUpdated, highToLowPressureTurbineIdealUpdated);
         } else {
-            return {0, highToLowPressureTurbine, highToLowPressureTurbineIdeal};
+            return {0, highToLowPressureTurbine, highToLowPressureTurbineIdeal, SteamReductionBranch::NOT_REDUCED};
         }
     } else {
-        return {0, highToLowPressureTurbine, highToLowPressureTurbineIdeal};
+        return {0, highToLowPressureTurbine, highToLowPressureTurbineIdeal, SteamReductionBranch::NOT_REDUCED};
     }
 }
 
@@ -69,10 +69,10 @@ SteamBalanceCheckerService::check(const std::string &itemName, const PressureTur
 
         const double remainingAdditionalSteamNeeded = steamReducerOutput.remainingAdditionalSteamNeeded;
 
-        restarter.restartIfNotEnoughSteam(remainingAdditionalSteamNeeded, boiler);
+        restarter.restartIfNotEnoughSteam(remainingAdditionalSteamNeeded, boiler, steamReducerOutput.reductionBranch);
         return steamReducerOutput;
     } else {
-        return {0, highToLowPressureTurbine, highToLowPressureTurbineIdeal};
+        return {0, highToLowPressureTurbine, highToLowPressureTurbineIdeal, SteamReductionBranch::NOT_REDUCED};
     }
 }
 
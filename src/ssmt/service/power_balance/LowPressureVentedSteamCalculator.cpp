@@ -13,7 +13,8 @@ LowPressureVentedSteamCalculator::calc(const int headerCountInput,
                                        const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
                                        MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
                                        const double deaeratorInletSteamMassFlow,
-                                       const bool recalcMakeupWaterAndMassFlow) const {
+                                       const bool recalcMakeupWaterAndMassFlow,
+                                       const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const {
     const std::string methodName = std::string("LowPressureVentedSteamCalculator::") + std::string(__func__) + ": ";
 
     //TODO check requ'd things?? or push to called methods?
@@ -80,7 +81,7 @@ LowPressureVentedSteamCalculator::calc(const int headerCountInput,
     const Deaerator &deaerator =
             deaeratorModeler.model(headerCountInput, boilerInput, boiler, highPressureHeaderCalculationsDomain,
                                    mediumPressureHeaderCalculationsDomain, lowPressureHeaderCalculationsDomain,
-                                   makeupWaterAndCondensateHeaderCalculationsDomain);
+                                   makeupWaterAndCondensateHeaderCalculationsDomain, deaeratorSaturatedProperties);
 //     std::cout << methodName << "deaerator=" << deaerator << std::endl;
 
     return {lowPressureVentedSteam, makeupWaterUpdated, makeupWaterAndCondensateHeaderOutputUpdated,
@@ -15,7 +15,8 @@ PowerBalanceChecker::check(const int headerCountInput, const HeaderWithHighestPr
                            const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
                            const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
                            const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
-                           MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain) const {
+                           MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeaderCalculationsDomain,
+                           const SteamSystemModelerTool::SaturatedPropertiesOutput &deaeratorSaturatedProperties) const {
     const std::string methodName = std::string("PowerBalanceChecker::") + std::string(__func__) + ": ";
 
     // std::cout << methodName << "calculating steamBalance" << std::endl;
@@ -51,7 +52,8 @@ PowerBalanceChecker::check(const int headerCountInput, const HeaderWithHighestPr
                                                           lowPressureHeaderCalculationsDomain,
                                                           makeupWaterAndCondensateHeaderCalculationsDomain,
                                                           deaeratorInletSteamMassFlowUpdated,
-                                                          recalcMakeupWaterAndMassFlow);
+                                                          recalcMakeupWaterAndMassFlow,
+                                                          deaeratorSaturatedProperties);
             // std::cout << methodName << "lowPressureVentedSteamCalculationsDomain="
                     //  << lowPressureVentedSteamCalculationsDomain << std::endl;
             lowPressureVentedSteamCalculationsDomainPtr =
@@ -82,7 +84,8 @@ PowerBalanceChecker::check(const int headerCountInput, const HeaderWithHighestPr
                                                           lowPressureHeaderCalculationsDomain,
                                                           makeupWaterAndCondensateHeaderCalculationsDomain,
                                                           deaeratorInletSteamMassFlowUpdated,
-                                                          recalcMakeupWaterAndMassFlow);
+                                                          recalcMakeupWaterAndMassFlow,
+                                                          deaeratorSaturatedProperties);
             // std::cout << methodName << "lowPressureVentedSteamCalculationsDomain="
                     //  << lowPressureVentedSteamCalculationsDomain << std::endl;
             lowPressureVentedSteamCalculationsDomainPtr =
@@ -7,15 +7,9 @@ MakeupWaterAndCondensateHeaderCalculator::calc(const BoilerInput &boilerInput,
                                                const std::shared_ptr<HeatExchanger::Output> &heatExchangerOutput,
                                                const SteamSystemModelerTool::FluidProperties &makeupWaterAndMassFlow,
                                                const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain) const {
-    SteamSystemModelerTool::FluidProperties headerResult =
-            makeHeaderResult(boilerInput, condensingTurbineInput, returnCondensate, heatExchangerOutput,
-                             makeupWaterAndMassFlow, highPressureHeaderCalculationsDomain);
-
-    SteamSystemModelerTool::SteamPropertiesOutput steamPropertiesOutput = calcSteamProperties(headerResult);
-
-    updateHeaderWithSteam(headerResult, steamPropertiesOutput);
-
-    return headerResult;
+    // the header properties already are the steam properties at deaerator pressure and the mixed enthalpy
+    return makeHeaderResult(boilerInput, condensingTurbineInput, returnCondensate, heatExchangerOutput,
+                            makeupWaterAndMassFlow, highPressureHeaderCalculationsDomain);
 }
 
 SteamSystemModelerTool::FluidProperties
@@ -43,27 +37,3 @@ MakeupWaterAndCondensateHeaderCalculator::makeHeaderResult(const BoilerInput &bo
 
     return fluidProperties;
 }
-
-SteamSystemModelerTool::SteamPropertiesOutput MakeupWaterAndCondensateHeaderCalculator::calcSteamProperties(
-        const SteamSystemModelerTool::FluidProperties &fluidProperties) const {
-    const std::string methodName =
-            std::string("MakeupWaterAndCondensateHeaderCalculator::") + std::string(__func__) + ": ";
-
-    const double pressure = fluidProperties.pressure;
-    const double specificEnthalpy = fluidProperties.specificEnthalpy;
-
-    SteamProperties steamProperties = {pressure, SteamProperties::ThermodynamicQuantity::ENTHALPY, specificEnthalpy};
-    const SteamSystemModelerTool::SteamPropertiesOutput &steamPropertiesOutput = steamProperties.calculate();
-//     std::cout << methodName << "pressure=" << pressure << ", specificEnthalpy=" << specificEnthalpy
-        //       << ", ThermodynamicQuantity=ENTHALPY" << "; result steamPropertiesOutput=" << steamPropertiesOutput
-        //       << std::endl;
-
-    return steamPropertiesOutput;
-}
-
-void
-MakeupWaterAndCondensateHeaderCalculator::updateHeaderWithSteam(SteamSystemModelerTool::FluidProperties &headerResult,
-                                                                const SteamSystemModelerTool::SteamPropertiesOutput &steamPropertiesOutput) const {
-    const double specificVolume = steamPropertiesOutput.specificVolume;
-    headerResult.specificVolume = specificVolume;
-}
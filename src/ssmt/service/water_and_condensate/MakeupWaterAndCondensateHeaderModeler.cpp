@@ -10,7 +10,8 @@ MakeupWaterAndCondensateHeaderModeler::model(const int headerCountInput,
                                              const std::shared_ptr<FlashTank> &blowdownFlashTank,
                                              const HighPressureHeaderCalculationsDomain &highPressureHeaderCalculationsDomain,
                                              const std::shared_ptr<MediumPressureHeaderCalculationsDomain> &mediumPressureHeaderCalculationsDomain,
-                                             const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain) const {
+                                             const std::shared_ptr<LowPressureHeaderCalculationsDomain> &lowPressureHeaderCalculationsDomain,
+                                             const SteamSystemModelerTool::SteamPropertiesOutput &makeupWaterOnly) const {
     const std::string methodName =
             std::string("MakeupWaterAndCondensateHeaderModeler::") + std::string(__func__) + ": ";
 
@@ -41,9 +42,7 @@ MakeupWaterAndCondensateHeaderModeler::model(const int headerCountInput,
             returnCondensateCalculationsDomain.returnCondensateFlashed;
 //     std::cout << methodName << "returnCondensateCalculationsDomain=" << returnCondensateCalculationsDomain << std::endl;
 
-    //5D. Calculate Makeup Water
-//     std::cout << methodName << "calculating makeupWaterOnly" << std::endl;
-    const SteamSystemModelerTool::SteamPropertiesOutput &makeupWaterOnly = makeupWaterCalculator.calc(operationsInput);
+    //5D. Makeup Water, calculated once per steam model run by SteamModelRunner
 //     std::cout << methodName << "makeupWaterOnly=" << makeupWaterOnly << std::endl;
 
     //5E. Calculate makeup water mass flow
@@ -16,4 +16,23 @@ TEST_CASE( "CurveFitVal", "[CurveFitVal]") {
 	CHECK(CurveFitVal({.25, .50, .75, 1.00, 1.25}, {0.93, 0.94, 0.95, 0.956, 0.949}, 4, 0.95).calculate() == Approx(0.95548));
 	CHECK(CurveFitVal({.25, .50, .75, 1.00, 1.25}, {0.93, 0.94, 0.95, 0.956, 0.949}, 4, 1.15).calculate() == Approx(0.954144));
 	CHECK(CurveFitVal({.25, .50, .75, 1.00, 1.25}, {0.93, 0.94, 0.95, 0.956, 0.949}, 4, 1.5).calculate() == Approx(0.915));
-}
\ No newline at end of file
+}
+
+TEST_CASE( "CurveFitVal fixed nodes", "[CurveFitVal]") {
+	const double efficiencies[] = {0.93, 0.94, 0.95, 0.956, 0.949};
+	const double currents[] = {36.8, 40.1, 46.3, 54.5, 64.8, 76.3};
+
+	for (double loadFactor = 0; loadFactor <= 1.5; loadFactor += 0.05) {
+		CHECK(CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, efficiencies, loadFactor)
+		      == Approx(CurveFitVal({.25, .50, .75, 1.00, 1.25}, {0.93, 0.94, 0.95, 0.956, 0.949}, 4, loadFactor).calculate()));
+		CHECK(CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, efficiencies + 2, loadFactor)
+		      == Approx(CurveFitVal({.75, 1.00, 1.25}, {0.95, 0.956, 0.949}, 2, loadFactor).calculate()));
+		CHECK(CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::ZERO_TO_HALF_LOAD, currents, loadFactor)
+		      == Approx(CurveFitVal({0, .25, .50}, {36.8, 40.1, 46.3}, 2, loadFactor).calculate()));
+	}
+
+	CHECK(CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, efficiencies, 0.15) == Approx(0.925944));
+	CHECK(CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::QUARTER_TO_125_LOAD, efficiencies, 1.5) == Approx(0.915));
+	CHECK(CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::ZERO_TO_HALF_LOAD, currents, 0) == Approx(36.8));
+	CHECK(CurveFitVal::fixedNodeFit(CurveFitVal::FixedNodes::THREE_QUARTER_TO_125_LOAD, currents + 3, 1.25) == Approx(76.3));
+}
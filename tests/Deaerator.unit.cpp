@@ -68,3 +68,23 @@ TEST_CASE( "Calculate the Inlet Steam Energy Flow for Deaerator calculator #2",
     CHECK( Deaerator(0.1998, 0.4, 41685, 0.1235, SteamProperties::ThermodynamicQuantity::ENTHALPY, 100, 0.4777, SteamProperties::ThermodynamicQuantity::ENTROPY, 6).getInletSteamProperties().energyFlow == Approx(18052836.5474));
 }
 
+
+TEST_CASE( "Deaerator from already calculated states", "[Deaerator][ssmt]") {
+    const double deaeratorPressure = 0.36;
+    const auto saturatedProperties =
+            SaturatedProperties(deaeratorPressure, SaturatedTemperature(deaeratorPressure).calculate()).calculate();
+    const auto inletWaterProperties =
+            SteamProperties(0.15, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 344.55).calculate();
+    const auto inletSteamProperties =
+            SteamProperties(0.4, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 528.65).calculate();
+
+    const unsigned long long before = SteamProperties::getCalculationCount();
+    const Deaerator deaerator = {deaeratorPressure, 0.2, 40279, saturatedProperties, inletWaterProperties,
+                                 inletSteamProperties};
+    CHECK(SteamProperties::getCalculationCount() == before);
+
+    CHECK(deaerator.getFeedwaterProperties().energyFlow == Approx(23706979.8592));
+    CHECK(deaerator.getVentedSteamProperties().massFlow == Approx(80.558));
+    CHECK(deaerator.getInletWaterProperties().massFlow == Approx(35929));
+    CHECK(deaerator.getInletWaterProperties().energyFlow == Approx(10741960.7053));
+}
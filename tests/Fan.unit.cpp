@@ -2,6 +2,9 @@
 #include <fans/Fan203.h>
 #include <fans/FanEnergyIndex.h>
 #include <fans/FanCurve.h>
+#include <fans/FanCurveFamily.h>
+#include <fans/FanSystemEnergyModel.h>
+#include <fans/Psychrometrics.h>
 
 TEST_CASE( "FanEnergyIndex", "[FanEnergyIndex]") {
 	CHECK(Approx(FanEnergyIndex(129691, -16, 1, 0.07024, 450).calculateEnergyIndex()) == 0.9678686743);
@@ -78,6 +81,114 @@ TEST_CASE( "Fan203", "[Fan203]") {
 	CHECK(results.converted.staticPressureRise == Approx(19.277771819));
 }
 
+TEST_CASE( "Fan203 traverse grid", "[Fan203]") {
+	std::vector< std::vector< double > > const traverseHoleData = {
+			{0.701, 0.703, 0.6675, 0.815, 0.979, 1.09, 1.155, 1.320, 1.578, 2.130},
+			{0.690, 0.648, 0.555, 0.760, 0.988, 1.060, 1.100, 1.110, 1.458, 1.865},
+			{0.691, 0.621, 0.610, 0.774, 0.747, 0.835, 0.8825, 1.23, 1.210, -0.1}
+	};
+
+	// the same readings with two unused readings at the end of each row
+	std::vector<double> readings;
+	for (auto const & row : traverseHoleData) {
+		readings.insert(readings.end(), row.begin(), row.end());
+		readings.insert(readings.end(), {99, 99});
+	}
+
+	TraversePlane const nested(143.63 * 32.63 / 144.0, 123.0, 26.57, -18.1, std::sqrt(0.762), traverseHoleData);
+	TraversePlane const flat(143.63 * 32.63 / 144.0, 123.0, 26.57, -18.1, std::sqrt(0.762),
+	                         TraverseGrid(3, 10, readings, 12));
+
+	CHECK(flat.getPv3Value() == nested.getPv3Value());
+	CHECK(flat.get75percentRule() == nested.get75percentRule());
+	CHECK(nested.getPv3Value() == Approx(0.6889757101));
+	CHECK(nested.get75percentRule() == Approx(29 / 30.0));
+
+	TraverseGrid const grid(3, 10, readings, 12);
+	CHECK(grid.getRows() == 3);
+	CHECK(grid.getColumns() == 10);
+	CHECK(grid.getStride() == 12);
+	CHECK(grid(1, 9) == 1.865);
+
+	CHECK_THROWS_AS(TraverseGrid(3, 10, std::vector<double>(30), 12), const std::runtime_error &);
+	CHECK_THROWS_AS(TraverseGrid(std::vector< std::vector< double > >{{1, 2}, {3}}), const std::runtime_error &);
+	CHECK_THROWS_AS(TraverseGrid(std::vector< std::vector< double > >()), const std::runtime_error &);
+
+	auto const makeFan = [](TraversePlane const & flowTraverse, double const fanSpeedCorrected) {
+		const double area = (143.63 * 32.63 * 2) / 144.0;
+		auto const motorShaftPower = FanShaftPower::calculateMotorShaftPower(4200, 205, 0.88) / 746.0;
+		return Fan203(FanRatedInfo(1191, 1191, fanSpeedCorrected, 0.05, 26.28),
+		              PlaneData(FlangePlane(area, 123, 26.57), FlangePlane(70 * 78 / 144.0, 132.7, 26.57),
+		                        flowTraverse, {}, MstPlane(area, 123.0, 26.57, -17.55),
+		                        MstPlane(55.42 * 60.49 / 144.0, 132.7, 26.57, 1.8), 0, 0.627, true),
+		              BaseGasDensity(123, -17.6, 26.57, 0.0547, BaseGasDensity::GasType::AIR),
+		              FanShaftPower(motorShaftPower, 95.0, 100, 100, 0));
+	};
+
+	std::vector<Fan203> fans = {makeFan(nested, 1170), makeFan(flat, 1170), makeFan(flat, 1100)};
+	auto const outputs = Fan203::calculate(fans);
+	REQUIRE(outputs.size() == 3);
+
+	for (std::size_t i = 0; i < fans.size(); i++) {
+		auto const single = (i < 2 ? makeFan(nested, 1170) : makeFan(flat, 1100)).calculate();
+		CHECK(outputs[i].fanEfficiencyTotalPressure == single.fanEfficiencyTotalPressure);
+		CHECK(outputs[i].asTested.flow == single.asTested.flow);
+		CHECK(outputs[i].converted.flow == single.converted.flow);
+		CHECK(outputs[i].converted.power == single.converted.power);
+		CHECK(outputs[i].converted.pressureTotal == single.converted.pressureTotal);
+	}
+	CHECK(outputs[2].converted.flow < outputs[1].converted.flow);
+}
+
+TEST_CASE( "PlaneData flange density iteration", "[Fan203]") {
+	std::vector< std::vector< double > > const traverseHoleData = {
+			{0.701, 0.703, 0.6675, 0.815, 0.979, 1.09, 1.155, 1.320, 1.578, 2.130},
+			{0.690, 0.648, 0.555, 0.760, 0.988, 1.060, 1.100, 1.110, 1.458, 1.865},
+			{0.691, 0.621, 0.610, 0.774, 0.747, 0.835, 0.8825, 1.23, 1.210, 1.569}
+	};
+	std::vector< std::vector< double > > const addlTraverseHoleData = {
+			{0.662, 0.568, 0.546, 0.564, 0.463, 0.507, 0.865, 1.017, 1.247, 1.630},
+			{0.639, 0.542, 0.530, 0.570, 0.603, 0.750, 0.965, 1.014, 1.246, 1.596},
+			{0.554, 0.452, 0.453, 0.581, 0.551, 0.724, 0.844, 1.077, 1.323, 1.620}
+	};
+	BaseGasDensity const baseGasDensity(123, -17.6, 26.57, 0.0547, BaseGasDensity::GasType::AIR);
+
+	auto const calculate = [&](double const outletArea, double const densityTolerance, bool const addlPlane) {
+		const double area = (143.63 * 32.63 * 2) / 144.0;
+		PlaneData planeData(FlangePlane(area, 123, 26.57), FlangePlane(outletArea, 132.7, 26.57),
+		                    TraversePlane(143.63 * 32.63 / 144.0, 123.0, 26.57, -18.1, std::sqrt(0.762), traverseHoleData),
+		                    addlPlane ? std::vector<TraversePlane>{{143.63 * 32.63 / 144.0, 123.0, 26.57, -17.0, std::sqrt(0.762), addlTraverseHoleData}}
+		                              : std::vector<TraversePlane>(),
+		                    MstPlane(area, 123.0, 26.57, -17.55), MstPlane(55.42 * 60.49 / 144.0, 132.7, 26.57, 1.8),
+		                    0, 0.627, true, densityTolerance);
+		return PlaneData::NodeBinding::calculate(planeData, baseGasDensity);
+	};
+
+	// results of the plain fixed point iteration this replaced
+	auto output = calculate(70 * 78 / 144.0, 0.0001, true);
+	CHECK(output.fanInletFlangeIterations == 1);
+	CHECK(output.fanOrEvaseOutletFlangeIterations == 2);
+	CHECK(output.fanInletFlange.gasDensity == Approx(0.0547079379107).epsilon(1e-10));
+	CHECK(output.fanInletFlange.staticPressure == Approx(-17.55).epsilon(1e-10));
+	CHECK(output.fanOrEvaseOutletFlange.gasDensity == Approx(0.0572316214208).epsilon(1e-10));
+	CHECK(output.fanOrEvaseOutletFlange.gasVolumeFlowRate == Approx(239302.598116).epsilon(1e-10));
+	CHECK(output.fanOrEvaseOutletFlange.gasVelocityPressure == Approx(1.89772739975).epsilon(1e-10));
+	CHECK(output.fanOrEvaseOutletFlange.staticPressure == Approx(4.34434889428).epsilon(1e-10));
+
+	// a small outlet, where the velocity pressure moves the density more
+	output = calculate(4.5, 0.0001, false);
+	auto const exact = calculate(4.5, 1e-13, false);
+	CHECK(output.fanOrEvaseOutletFlangeIterations == 3);
+	CHECK(exact.fanOrEvaseOutletFlangeIterations <= 7);
+	CHECK(exact.fanOrEvaseOutletFlange.gasDensity == Approx(0.0502962888378).epsilon(1e-10));
+	CHECK(output.fanOrEvaseOutletFlange.gasDensity == Approx(0.0503094963404).margin(0.0001));
+	CHECK(output.fanOrEvaseOutletFlange.gasDensity == Approx(exact.fanOrEvaseOutletFlange.gasDensity).margin(0.0001));
+	CHECK(output.fanOrEvaseOutletFlange.staticPressure
+	      == Approx(output.fanOrEvaseOutletFlange.gasTotalPressure - output.fanOrEvaseOutletFlange.gasVelocityPressure));
+
+	CHECK_THROWS_AS(calculate(4.5, 0, false), const std::runtime_error &);
+}
+
 TEST_CASE( "FanCurve", "[Fan203][FanCurve]") {
 	// using row 2 appendix 1
 	double density = 0.0308, n = 1180, densityC = 0.0332, nC = 1187, pb = 29.36;
@@ -163,6 +274,187 @@ TEST_CASE( "FanCurve", "[Fan203][FanCurve]") {
 	}
 }
 
+TEST_CASE( "FanCurve columns", "[Fan203][FanCurve]") {
+	double density = 0.0308, n = 1180, densityC = 0.0332, nC = 1187, pb = 29.36;
+	double pbC = 29.36, pt1F = -0.93736, gamma = 1.4, gammaC = 1.4, a1 = 34, a2 = 12.7;
+
+	// a dense curve through the appendix 1 row 2 points, half at another rated speed
+	std::vector<FanCurveData::BaseOperatingPoint> rows;
+	for (int i = 0; i <= 2000; i++) {
+		double const flow = 201741.0 * i / 2000;
+		double const pressure = 22.3 + 1.2e-5 * flow - 6.2e-10 * flow * flow;
+		double const power = 115 + 2.6e-3 * flow + 5e-9 * flow * flow;
+		rows.emplace_back(flow, pressure, power, density, i % 2 ? n : 1150, nC, pb, i % 3 != 0, -0.9);
+	}
+
+	for (auto const curveType : {FanCurveType::FanStaticPressure, FanCurveType::FanTotalPressure,
+	                             FanCurveType::StaticPressureRise}) {
+		FanCurve fc(density, densityC, n, nC, pb, pbC, pt1F, gamma, gammaC, a1, a2, FanCurveData(curveType, rows));
+		auto const results = fc.calculate();
+		auto const columns = fc.calculateColumns();
+		REQUIRE(results.size() == rows.size());
+		REQUIRE(columns.flow.size() == results.size());
+		REQUIRE(columns.efficiency.size() == results.size());
+		for (std::size_t i = 0; i < results.size(); i++) {
+			CHECK(columns.flow[i] == results[i].flow);
+			CHECK(columns.pressure[i] == results[i].pressure);
+			CHECK(columns.power[i] == results[i].power);
+			CHECK(columns.efficiency[i] == results[i].efficiency);
+		}
+		CHECK(results[0].flow == 0);
+		CHECK(results[0].efficiency == 0);
+		CHECK(results[1000].flow == Approx(100870.5 * nC / 1150).epsilon(0.01));
+	}
+}
+
+TEST_CASE( "FanCurveFamily", "[Fan203][FanCurve]") {
+	double density = 0.0308, n = 1180, densityC = 0.0332, nC = 1187, pb = 29.36;
+	double pbC = 29.36, pt1F = -0.93736, gamma = 1.4, gammaC = 1.4, a1 = 34, a2 = 12.7;
+	FanCurveType curveType = FanCurveType::StaticPressureRise;
+
+	std::vector<FanCurveData::BaseCurve> baseCurveData = {
+			{0, 22.3, 115}, {14410, 22.5, 154}, {28820, 22.3, 194}, {43230, 21.8, 241}, {57640, 21.2, 293},
+			{72050, 20.3, 349}, {86460, 19.3, 406}, {100871, 18, 462}, {115281, 16.5, 515}, {129691, 14.8, 566},
+			{144101, 12.7, 615}, {158511, 10.2, 667}, {172921, 7.3, 725}, {187331, 3.7, 789}, {201741, -0.8, 861}
+	};
+	std::vector<FanCurveData::RatedPoint> ratedPointData;
+	for (auto const & row : baseCurveData) {
+		ratedPointData.emplace_back(row.flow, row.pressure, row.power, density, n, nC);
+	}
+
+	FanCurveFamily const baseFamily(FanCurve(density, densityC, n, nC, pb, pbC, pt1F, gamma, gammaC, a1, a2,
+	                                         FanCurveData(curveType, baseCurveData)));
+	FanCurveFamily const ratedFamily(FanCurve(density, densityC, n, nC, pb, pbC, pt1F, gamma, gammaC, a1, a2,
+	                                          FanCurveData(curveType, ratedPointData)));
+
+	std::vector<FanCurveFamily::Correction> corrections;
+	for (double speed = 600; speed <= 1400; speed += 100) {
+		corrections.push_back({speed, densityC * speed / 1000, pbC - speed / 1000});
+	}
+	auto const baseCurves = baseFamily.calculate(corrections);
+	auto const ratedCurves = ratedFamily.calculate(corrections);
+	REQUIRE(baseCurves.size() == corrections.size());
+	REQUIRE(ratedCurves.size() == corrections.size());
+
+	for (std::size_t c = 0; c < corrections.size(); c++) {
+		auto const & correction = corrections[c];
+		std::vector<FanCurveData::RatedPoint> correctedRows;
+		for (auto const & row : baseCurveData) {
+			correctedRows.emplace_back(row.flow, row.pressure, row.power, density, n, correction.speedCorrected);
+		}
+		auto const expected = FanCurve(density, correction.densityCorrected, n, correction.speedCorrected, pb,
+		                               correction.pressureBarometricCorrected, pt1F, gamma, gammaC, a1, a2,
+		                               FanCurveData(curveType, baseCurveData)).calculateColumns();
+		auto const expectedRated = FanCurve(density, correction.densityCorrected, n, correction.speedCorrected, pb,
+		                                    correction.pressureBarometricCorrected, pt1F, gamma, gammaC, a1, a2,
+		                                    FanCurveData(curveType, correctedRows)).calculateColumns();
+		REQUIRE(baseCurves[c].flow.size() == expected.flow.size());
+		REQUIRE(ratedCurves[c].flow.size() == expectedRated.flow.size());
+		for (std::size_t i = 0; i < expected.flow.size(); i++) {
+			CHECK(baseCurves[c].flow[i] == expected.flow[i]);
+			CHECK(baseCurves[c].pressure[i] == expected.pressure[i]);
+			CHECK(baseCurves[c].power[i] == expected.power[i]);
+			CHECK(baseCurves[c].efficiency[i] == expected.efficiency[i]);
+		}
+		for (std::size_t i = 0; i < expectedRated.flow.size(); i++) {
+			CHECK(ratedCurves[c].flow[i] == expectedRated.flow[i]);
+			CHECK(ratedCurves[c].power[i] == expectedRated.power[i]);
+		}
+	}
+
+	// the family's own correction reproduces the curve
+	auto const own = baseFamily.calculate({nC, densityC, pbC});
+	auto const results = FanCurve(density, densityC, n, nC, pb, pbC, pt1F, gamma, gammaC, a1, a2,
+	                              FanCurveData(curveType, baseCurveData)).calculate();
+	REQUIRE(own.flow.size() == results.size());
+	CHECK(own.flow[7] == results[7].flow);
+	CHECK(own.pressure[7] == results[7].pressure);
+}
+
+TEST_CASE( "FanSystemEnergyModel", "[Fan203][FanCurve][FanSystemEnergyModel]") {
+	std::vector<FanCurveData::BaseCurve> const baseCurveData = {
+			{0, 22.3, 115}, {14410, 22.5, 154}, {28820, 22.3, 194}, {43230, 21.8, 241}, {57640, 21.2, 293},
+			{72050, 20.3, 349}, {86460, 19.3, 406}, {100871, 18, 462}, {115281, 16.5, 515}, {129691, 14.8, 566},
+			{144101, 12.7, 615}, {158511, 10.2, 667}, {172921, 7.3, 725}, {187331, 3.7, 789}, {201741, -0.8, 861}
+	};
+	FanCurve const curve(0.0308, 0.0332, 1180, 1187, 29.36, 29.36, -0.93736, 1.4, 1.4, 34, 12.7,
+	                     FanCurveData(FanCurveType::FanStaticPressure, baseCurveData));
+	auto const type = OptimalFanEfficiency::FanType::AirfoilSISW;
+
+	// the design point is the 130609.56 cfm row of the corrected curve, see the FanCurve test
+	double const design = 130609.5615402702;
+	FanSystemEnergyModel const model(curve, type, design, 5, 95, 97, 96);
+	CHECK(model.systemPressure(design) == Approx(16.1615468983));
+	CHECK(model.systemPressure(0) == 5);
+	CHECK(model.getDesignFanEfficiency() == Approx(0.5266325641));
+	CHECK(model.getOptimalFanEfficiency()
+	      == Approx(OptimalFanEfficiency(type, 1187, design, 0, 16.1615468983, 1).calculate()));
+	CHECK(model.speedRatio(design) == 1);
+
+	std::vector<FanSystemEnergyModel::Bin> const profile = {{design, 1000}, {0.8 * design, 3000}, {0.5 * design, 2000}, {0, 2760}};
+	auto const damper = model.calculate(FanSystemEnergyModel::Control::OutletDamper, profile);
+	auto const vanes = model.calculate(FanSystemEnergyModel::Control::InletVanes, profile);
+	auto const vfd = model.calculate(FanSystemEnergyModel::Control::VFD, profile);
+
+	// at the design point the damper and the VFD are open and at full speed
+	CHECK(damper.fanShaftPower[0] == Approx(621.736485987));
+	CHECK(damper.motorPower[0] == Approx(621.736485987 * 0.7457 / (0.95 * 0.97)));
+	CHECK(vfd.fanShaftPower[0] == Approx(damper.fanShaftPower[0]));
+	CHECK(vfd.motorPower[0] == Approx(damper.motorPower[0] / 0.96));
+	CHECK(vanes.fanShaftPower[0] == Approx(621.736485987));
+	CHECK(damper.pressure[0] == Approx(vfd.pressure[0]));
+	CHECK(vfd.fanEfficiency[0] == Approx(0.5266325641));
+	CHECK(vanes.fanEfficiency[0] == Approx(0.5266325641));
+
+	// the damper rides the fan curve, the others follow the system curve
+	CHECK(damper.pressure[2] == Approx(22.6687671099));
+	CHECK(vanes.pressure[2] == Approx(model.systemPressure(0.5 * design)));
+	CHECK(vfd.pressure[2] == Approx(model.systemPressure(0.5 * design)));
+	CHECK(vfd.speedRatio[1] < 1);
+	CHECK(vfd.speedRatio[2] < vfd.speedRatio[1]);
+	CHECK(damper.speedRatio[2] == 1);
+	CHECK(vfd.speedRatio[3] == 0);
+
+	for (auto const & output : {damper, vanes, vfd}) {
+		CHECK(output.hours == 8760);
+		CHECK(output.motorPower[3] == 0);
+		CHECK(output.fanEnergyIndex[3] == 0);
+		double annualEnergy = 0;
+		for (std::size_t i = 0; i < profile.size(); i++) {
+			CHECK(output.energy[i] == Approx(output.motorPower[i] * profile[i].hours));
+			annualEnergy += output.energy[i];
+		}
+		CHECK(output.annualEnergy == Approx(annualEnergy));
+		CHECK(output.fanEnergyIndex[1] == Approx(FanEnergyIndex(0.8 * design, 0, output.pressure[1], 0.0332,
+		                                                        output.motorPower[1]).calculateEnergyIndex()));
+	}
+	CHECK(vfd.annualEnergy < vanes.annualEnergy);
+	CHECK(vanes.annualEnergy < damper.annualEnergy);
+
+	// with no static pressure the system curve is the fan law parabola through the design point
+	FanSystemEnergyModel const noStatic(curve, type, design, 0, 95, 97, 96);
+	auto const parabola = noStatic.calculate(FanSystemEnergyModel::Control::VFD, profile);
+	CHECK(parabola.speedRatio[1] == Approx(0.8));
+	CHECK(parabola.speedRatio[2] == Approx(0.5));
+	CHECK(parabola.fanShaftPower[1] == Approx(621.736485987 * 0.512));
+	CHECK(parabola.fanShaftPower[2] == Approx(621.736485987 * 0.125));
+
+	// an hourly profile is the same as bins of an hour
+	std::vector<double> hourly;
+	for (auto const & bin : profile) {
+		hourly.insert(hourly.end(), static_cast<std::size_t>(bin.hours), bin.flowRate);
+	}
+	auto const hourlyVfd = model.calculate(FanSystemEnergyModel::Control::VFD, hourly);
+	CHECK(hourlyVfd.motorPower.size() == 8760);
+	CHECK(hourlyVfd.hours == 8760);
+	CHECK(hourlyVfd.annualEnergy == Approx(vfd.annualEnergy));
+	CHECK(hourlyVfd.speedRatio[1500] == vfd.speedRatio[1]);
+
+	CHECK_THROWS_AS(model.calculate(FanSystemEnergyModel::Control::VFD, std::vector<double>{1.01 * design}),
+	                const std::runtime_error &);
+	CHECK_THROWS_AS(FanSystemEnergyModel(curve, type, design, 20, 95, 97, 96), const std::runtime_error &);
+}
+
 TEST_CASE( "BaseGasDensity", "[BaseGasDensity]") {
 	auto const bdg = BaseGasDensity(
 			70, 26.62, 29.92, 60, BaseGasDensity::GasType::AIR, BaseGasDensity::InputType::RelativeHumidity, 1
@@ -229,3 +521,46 @@ TEST_CASE( "BaseGasDensity", "[BaseGasDensity]") {
 	CHECK(bdg4.getSaturationPressure() == Approx(0.3004293578)); // satPress
 	CHECK(bdg4.getWetBulbTemp() == Approx(37.7031079652)); // Tdb
 }
+
+TEST_CASE( "Psychrometrics", "[BaseGasDensity][Psychrometrics]") {
+	CHECK(Psychrometrics::saturationPressure(70) == Approx(0.739659));
+	CHECK(Psychrometrics::saturationPressure(45) == Approx(0.3004293578));
+
+	// analytic derivatives against central differences, over ice and over water
+	for (auto const t : {-20.0, 20.0, 45.0, 70.0, 150.0}) {
+		auto const dP = (Psychrometrics::saturationPressure(t + 0.001) - Psychrometrics::saturationPressure(t - 0.001)) / 0.002;
+		CHECK(Psychrometrics::saturationPressureDerivative(t) == Approx(dP).epsilon(1e-6));
+
+		auto const dW = (Psychrometrics::humidityRatioFromWetBulb(t + 10, t + 0.001, 29.92, 0.24)
+		                 - Psychrometrics::humidityRatioFromWetBulb(t + 10, t - 0.001, 29.92, 0.24)) / 0.002;
+		CHECK(Psychrometrics::humidityRatioFromWetBulbDerivative(t + 10, t, 29.92, 0.24) == Approx(dW).epsilon(1e-6));
+	}
+
+	// the wet bulb temperature gives back the humidity ratio, saturated air is at its dry bulb temperature
+	for (auto const dryBulb : {10.0, 45.0, 70.0, 120.0}) {
+		for (auto const rh : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+			auto const wetBulb = Psychrometrics::wetBulbTemperature(dryBulb, rh, 31.8761);
+			auto const w = Psychrometrics::humidityRatio(dryBulb, rh, 31.8761);
+			CHECK(wetBulb <= dryBulb);
+			CHECK(Psychrometrics::humidityRatioFromWetBulb(dryBulb, wetBulb, 31.8761, 0.24) == Approx(w).margin(0.00001));
+		}
+	}
+	CHECK(Psychrometrics::wetBulbTemperature(70, 1, 31.8761) == Approx(70).margin(0.01));
+	CHECK(Psychrometrics::wetBulbTemperature(70, 0.6, 31.8761) == Approx(61.1895184019));
+	CHECK(Psychrometrics::wetBulbTemperature(45, 0.5, 29.28) == Approx(37.7031079652));
+	CHECK(Psychrometrics::relativeHumidityFromWetBulb(70, 61.2, 31.8761, 0.24) == Approx(0.600272));
+	CHECK(Psychrometrics::dewPoint(45, 0.0032073881, 29.28) == Approx(27.3784844278));
+
+	std::vector<double> const dryBulbs = {45, 70, 95}, humidities = {0.5, 0.6, 0.2};
+	auto const wetBulbs = Psychrometrics::wetBulbTemperature(dryBulbs, humidities, 29.92);
+	auto const ratios = Psychrometrics::humidityRatio(dryBulbs, humidities, 29.92);
+	auto const dewPoints = Psychrometrics::dewPoint(dryBulbs, ratios, 29.92);
+	auto const pressures = Psychrometrics::saturationPressure(dryBulbs);
+	for (std::size_t i = 0; i < dryBulbs.size(); i++) {
+		CHECK(wetBulbs[i] == Psychrometrics::wetBulbTemperature(dryBulbs[i], humidities[i], 29.92));
+		CHECK(ratios[i] == Psychrometrics::humidityRatio(dryBulbs[i], humidities[i], 29.92));
+		CHECK(dewPoints[i] == Psychrometrics::dewPoint(dryBulbs[i], ratios[i], 29.92));
+		CHECK(pressures[i] == Psychrometrics::saturationPressure(dryBulbs[i]));
+	}
+	CHECK_THROWS_AS(Psychrometrics::wetBulbTemperature(dryBulbs, {0.5}, 29.92), const std::runtime_error &);
+}
@@ -1,5 +1,7 @@
 #include "catch.hpp"
 #include <calculator/pump/HeadTool.h>
+#include <calculator/pump/HeadToolBatch.h>
+#include <calculator/pump/SystemCurve.h>
 
 TEST_CASE( "Calculate Pump Head with and without suction tanks", "[HeadToolCalculations]" ) {
 	const double flowRate = 2000;
@@ -63,3 +65,82 @@ TEST_CASE( "Calculate Pump Head with and without suction tanks", "[HeadToolCalcu
 	CHECK(res.suctionHead == Approx(0.0101039693));
 	CHECK(res.dischargeHead == Approx(0.0007203468));
 }
+
+TEST_CASE( "HeadToolBatch matches single point head tools", "[HeadToolCalculations]" ) {
+	const std::vector<double> flowRates = {0, 500, 1250, 2000, 2600};
+	const std::vector<double> suctionPressures = {12, 10, 7.5, 5, 1};
+	const std::vector<double> dischargePressures = {60, 55, 52, 50, 41};
+
+	const HeadToolBatch gauge(HeadToolBatch::Suction::GAUGE, 1.1, 17.9, 5, 0.5, 15, 1, 0.9);
+	auto res = gauge.calculate(flowRates, suctionPressures, dischargePressures);
+	std::vector<double> pumpHeads(flowRates.size());
+	gauge.calculate(flowRates.data(), suctionPressures.data(), dischargePressures.data(), pumpHeads.data(), flowRates.size());
+	CHECK(res.elevationHead == Approx(-4.0));
+	for (std::size_t i = 0; i < flowRates.size(); ++i) {
+		auto const expected = HeadTool(1.1, flowRates[i], 17.9, suctionPressures[i], 5, 0.5, 15, dischargePressures[i], 1, 0.9).calculate();
+		CHECK(res.pumpHead[i] == Approx(expected.pumpHead));
+		CHECK(res.pressureHead[i] == Approx(expected.pressureHead));
+		CHECK(res.velocityHeadDifferential[i] == Approx(expected.velocityHeadDifferential).margin(1e-12));
+		CHECK(res.suctionHead[i] == Approx(expected.suctionHead).margin(1e-12));
+		CHECK(res.dischargeHead[i] == Approx(expected.dischargeHead).margin(1e-12));
+		CHECK(pumpHeads[i] == Approx(expected.pumpHead));
+	}
+
+	const HeadToolBatch tank(HeadToolBatch::Suction::TANK, 1, 17.9, 5, 1, 15, 0, 1);
+	res = tank.calculate(flowRates, suctionPressures, dischargePressures);
+	tank.calculate(flowRates.data(), suctionPressures.data(), dischargePressures.data(), pumpHeads.data(), flowRates.size());
+	CHECK(res.elevationHead == Approx(-5.0));
+	for (std::size_t i = 0; i < flowRates.size(); ++i) {
+		auto const expected = HeadToolSuctionTank(1, flowRates[i], 17.9, suctionPressures[i], 5, 1, 15, dischargePressures[i], 0, 1).calculate();
+		CHECK(res.pumpHead[i] == Approx(expected.pumpHead));
+		CHECK(res.velocityHeadDifferential[i] == Approx(expected.velocityHeadDifferential).margin(1e-12));
+		CHECK(res.suctionHead[i] == Approx(expected.suctionHead).margin(1e-12));
+		CHECK(pumpHeads[i] == Approx(expected.pumpHead));
+	}
+
+	CHECK_THROWS_AS(tank.calculate(flowRates, suctionPressures, {50}), const std::runtime_error &);
+}
+
+TEST_CASE( "System curve fit and dense curve", "[HeadToolCalculations]" ) {
+	const SystemCurve system(40, 1.5e-5);
+	std::vector<SystemCurve::Point> points;
+	for (double flowRate = 400; flowRate <= 2400; flowRate += 250) {
+		points.push_back({flowRate, system.head(flowRate)});
+	}
+
+	auto fitted = SystemCurve::fit(points);
+	CHECK(fitted.getStaticHead() == Approx(40));
+	CHECK(fitted.getLossCoefficient() == Approx(1.5e-5));
+
+	fitted = SystemCurve::fit(40, points);
+	CHECK(fitted.getLossCoefficient() == Approx(1.5e-5));
+
+	// readings scattered about the curve average out
+	for (std::size_t i = 0; i < points.size(); ++i) {
+		points[i].head += i % 2 ? 0.5 : -0.5;
+	}
+	points.push_back({1400, system.head(1400)});
+	fitted = SystemCurve::fit(points);
+	CHECK(fitted.getStaticHead() == Approx(40).epsilon(0.01));
+	CHECK(fitted.getLossCoefficient() == Approx(1.5e-5).epsilon(0.01));
+
+	auto const curve = system.curve(3000, 31);
+	REQUIRE(curve.size() == 31);
+	CHECK(curve.front().flowRate == 0);
+	CHECK(curve.front().head == Approx(40));
+	CHECK(curve[10].flowRate == Approx(1000));
+	CHECK(curve[10].head == Approx(55));
+	CHECK(curve.back().flowRate == 3000);
+	CHECK(curve.back().head == Approx(175));
+
+	std::vector<double> flowRates = {0, 1000, 3000}, heads(3);
+	system.head(flowRates.data(), heads.data(), heads.size());
+	CHECK(heads[1] == Approx(55));
+	CHECK(system.flowRate(55) == Approx(1000));
+	CHECK(system.flowRate(30) == 0);
+
+	CHECK_THROWS_AS(SystemCurve::fit({{1000, 55}}), const std::runtime_error &);
+	CHECK_THROWS_AS(SystemCurve::fit({{1000, 55}, {1000, 56}}), const std::runtime_error &);
+	CHECK_THROWS_AS(SystemCurve::fit(40, {{0, 40}}), const std::runtime_error &);
+	CHECK_THROWS_AS(system.curve(3000, 1), const std::runtime_error &);
+}
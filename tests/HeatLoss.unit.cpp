@@ -36,3 +36,42 @@ TEST_CASE( "Calculate the Outlet Energy Flow #2", "[Outlet Energy Flow][HeatLoss
 TEST_CASE( "Calculate the Heat Loss #2", "[Heat Loss][HeatLoss][ssmt]") {
     CHECK( HeatLoss(5.1414, SteamProperties::ThermodynamicQuantity::ENTHALPY, 2000, 36011, 3.11).getHeatLoss() == Approx(2239884.2));
 }
+
+TEST_CASE( "Calculate the Heat Loss reusing previous properties", "[Heat Loss][HeatLoss][ssmt]") {
+    const auto previous = HeatLoss(2.418, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 521, 5434, 2.44);
+    CHECK_FALSE( previous.isReusedFromPrevious() );
+
+    const auto reused = HeatLoss(previous, 2.418, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 521, 6000, 2.44);
+    const auto fresh = HeatLoss(2.418, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 521, 6000, 2.44);
+    CHECK( reused.isReusedFromPrevious() );
+    CHECK( reused.getInletProperties().energyFlow == Approx(fresh.getInletProperties().energyFlow));
+    CHECK( reused.getOutletProperties().energyFlow == Approx(fresh.getOutletProperties().energyFlow));
+    CHECK( reused.getOutletProperties().temperature == Approx(fresh.getOutletProperties().temperature));
+    CHECK( reused.getOutletProperties().specificEntropy == Approx(fresh.getOutletProperties().specificEntropy));
+    CHECK( reused.getHeatLoss() == Approx(fresh.getHeatLoss()));
+
+    const auto changed = HeatLoss(previous, 2.418, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 521, 6000, 3.0);
+    CHECK_FALSE( changed.isReusedFromPrevious() );
+    CHECK( changed.getHeatLoss() == Approx(HeatLoss(2.418, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 521, 6000, 3.0).getHeatLoss()));
+}
+
+TEST_CASE( "Calculate the Heat Loss for a batch of segments", "[Heat Loss][HeatLoss][ssmt]") {
+    const std::vector<HeatLoss::Input> segments = {
+            {2.418, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 521, 5434, 2.44},
+            {2.418, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 521, 1000, 2.44},
+            {5.1414, SteamProperties::ThermodynamicQuantity::ENTHALPY, 2000, 36011, 3.11}
+    };
+
+    const auto results = HeatLoss::calculate(segments);
+    REQUIRE( results.size() == 3 );
+    CHECK_FALSE( results[0].isReusedFromPrevious() );
+    CHECK( results[1].isReusedFromPrevious() );
+    CHECK_FALSE( results[2].isReusedFromPrevious() );
+    CHECK( results[0].getHeatLoss() == Approx(381688.4));
+    CHECK( results[2].getHeatLoss() == Approx(2239884.2));
+
+    const auto rerun = HeatLoss::calculate(segments, results);
+    CHECK( rerun[0].isReusedFromPrevious() );
+    CHECK( rerun[2].isReusedFromPrevious() );
+    CHECK( rerun[2].getOutletProperties().energyFlow == Approx(69782115.79));
+}
@@ -0,0 +1,83 @@
+#include "catch.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <calculator/motor/MotorShaftPower.h>
+#include <calculator/motor/MotorEfficiency.h>
+#include <calculator/motor/MotorCurrent.h>
+#include <calculator/motor/MotorPowerFactor.h>
+#include <calculator/motor/EstimateFLA.h>
+#include <calculator/motor/OptimalMotorPower.h>
+#include <results/Results.h>
+
+// Counts heap allocations of the whole test executable while counting is on. The default array and nothrow forms
+// of operator new forward to this one.
+namespace {
+    std::atomic<bool> counting(false);
+    std::atomic<int> allocations(0);
+
+    template <class Calculation>
+    int countAllocations(Calculation calculation) {
+        allocations = 0;
+        counting = true;
+        calculation();
+        counting = false;
+        return allocations;
+    }
+}
+
+void * operator new(std::size_t size) {
+    if (counting) {
+        ++allocations;
+    }
+    void * p = std::malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void * p) noexcept {
+    std::free(p);
+}
+
+TEST_CASE( "Motor calculations do not allocate", "[MotorAllocation]" ) {
+    std::vector<double> buffer;
+    CHECK(countAllocations([&] { buffer.resize(6); }) == 1);
+
+    auto const fq60 = Motor::LineFrequency::FREQ60;
+    for (auto const efficiencyClass : {Motor::EfficiencyClass::STANDARD, Motor::EfficiencyClass::ENERGY_EFFICIENT,
+                                       Motor::EfficiencyClass::PREMIUM, Motor::EfficiencyClass::SPECIFIED}) {
+        for (auto const loadSolver : {Motor::LoadSolver::STEP, Motor::LoadSolver::BISECTION}) {
+            MotorShaftPower byPower(200, 80, 1780, fq60, efficiencyClass, 95, 460, 225.8, 460,
+                                    Motor::LoadEstimationMethod::POWER, 0, loadSolver);
+            MotorShaftPower byCurrent(200, 80, 1780, fq60, efficiencyClass, 95, 460, 225.8, 460,
+                                      Motor::LoadEstimationMethod::CURRENT, 125.857, loadSolver);
+            CHECK(countAllocations([&] { byPower.calculate(); }) == 0);
+            CHECK(countAllocations([&] { byCurrent.calculate(); }) == 0);
+        }
+
+        CHECK(countAllocations([&] { MotorEfficiency(fq60, 1780, efficiencyClass, 200).calculate(0.6, 95); }) == 0);
+        CHECK(countAllocations([&] {
+            MotorCurrent(200, 1780, fq60, efficiencyClass, 95, 0.6, 460).calculateCurrent(225.8);
+        }) == 0);
+        CHECK(countAllocations([&] { EstimateFLA(200, 1780, fq60, efficiencyClass, 95, 460).calculate(); }) == 0);
+        CHECK(countAllocations([&] { MotorPowerFactor(200, 0.6, 100, 95, 460).calculate(); }) == 0);
+        CHECK(countAllocations([&] {
+            OptimalMotorPower(200, 1780, fq60, efficiencyClass, 95, 460, 460, 120).calculate();
+        }) == 0);
+    }
+}
+
+TEST_CASE( "PSAT results do not allocate", "[MotorAllocation]" ) {
+    Pump::Input const pump(Pump::Style::END_SUCTION_ANSI_API, 0.8, 1780, Motor::Drive::N_V_BELT_DRIVE, 1.0, 1.0, 1,
+                           Pump::SpecificSpeed::FIXED_SPEED, 0);
+    Motor const motor(Motor::LineFrequency::FREQ60, 200, 1780, Motor::EfficiencyClass::ENERGY_EFFICIENT, 0, 460, 225.8, 0);
+    for (auto const loadEstimationMethod : {Motor::LoadEstimationMethod::POWER, Motor::LoadEstimationMethod::CURRENT}) {
+        Pump::FieldData const fieldData(2000, 277, loadEstimationMethod, 150, 125.857, 460);
+        PSATResult result(pump, motor, fieldData, 8760, 0.05);
+        CHECK(countAllocations([&] { result.calculateExisting(); }) == 0);
+        CHECK(countAllocations([&] { result.calculateModified(); }) == 0);
+    }
+}
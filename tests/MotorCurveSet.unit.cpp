@@ -0,0 +1,134 @@
+#include "catch.hpp"
+#include <calculator/motor/MotorCurveSet.h>
+#include <calculator/motor/MotorEfficiency.h>
+#include <calculator/motor/MotorCurrent.h>
+#include <calculator/motor/MotorPowerFactor.h>
+#include <calculator/motor/MotorShaftPower.h>
+#include <calculator/motor/OptimalMotorPower.h>
+
+TEST_CASE( "MotorCurveSet matches the single point calculators", "[MotorCurveSet]" ) {
+    auto const fq60 = Motor::LineFrequency::FREQ60;
+    struct Case {
+        Motor::LineFrequency lineFrequency;
+        double rpm;
+        Motor::EfficiencyClass efficiencyClass;
+        double ratedPower, specifiedEfficiency, ratedVoltage, fullLoadAmps;
+    };
+    const Case cases[] = {
+            {fq60, 1785, Motor::EfficiencyClass::ENERGY_EFFICIENT, 200, 0, 460, 225.8},
+            {fq60, 1185, Motor::EfficiencyClass::STANDARD, 350, 0, 2300, 83},
+            {fq60, 3560, Motor::EfficiencyClass::PREMIUM, 50, 0, 575, 47},
+            {fq60, 1780, Motor::EfficiencyClass::SPECIFIED, 200, 95, 460, 225},
+            {Motor::LineFrequency::FREQ50, 1480, Motor::EfficiencyClass::SPECIFIED, 100, 93, 400, 130},
+    };
+
+    for (auto const & c : cases) {
+        MotorCurveSet const curves(c.lineFrequency, c.rpm, c.efficiencyClass, c.ratedPower, c.specifiedEfficiency,
+                                   c.ratedVoltage, c.fullLoadAmps);
+        for (int i = 0; i <= 160; i += 3) {
+            double const loadFactor = i / 100.0;
+            MotorEfficiency motorEfficiency(c.lineFrequency, c.rpm, c.efficiencyClass, c.ratedPower);
+            double const efficiency = motorEfficiency.calculate(loadFactor, c.specifiedEfficiency);
+            MotorCurrent motorCurrent(c.ratedPower, c.rpm, c.lineFrequency, c.efficiencyClass, c.specifiedEfficiency,
+                                      loadFactor, c.ratedVoltage);
+            double const current = motorCurrent.calculateCurrent(c.fullLoadAmps);
+            double const powerFactor = MotorPowerFactor(c.lineFrequency, c.rpm, c.efficiencyClass,
+                                                        c.specifiedEfficiency, c.ratedPower, loadFactor, current,
+                                                        efficiency, c.ratedVoltage).calculate();
+
+            CHECK(curves.efficiency(loadFactor) == efficiency);
+            CHECK(curves.current(loadFactor) == current);
+            CHECK(curves.optimalCurrent(loadFactor) == motorCurrent.calculateOptimalCurrent());
+            CHECK(curves.powerFactor(loadFactor, current, efficiency, c.ratedVoltage) == powerFactor);
+            CHECK(curves.getEstimatedFLA() == motorCurrent.getEstimatedFLA());
+        }
+    }
+}
+
+TEST_CASE( "MotorCurveSet shared by MotorShaftPower and OptimalMotorPower", "[MotorCurveSet]" ) {
+    MotorCurveSet const curves(Motor::LineFrequency::FREQ60, 1780, Motor::EfficiencyClass::SPECIFIED, 200, 95, 460,
+                               225);
+
+    auto const power = MotorShaftPower(curves, 80, 480, Motor::LoadEstimationMethod::POWER, 125.857).calculate();
+    CHECK(power.shaftPower == Approx(101.18747791246317));
+    CHECK(power.efficiency * 100 == Approx(94.35732315337191));
+    CHECK(power.powerFactor * 100 == Approx(76.45602656178534));
+    CHECK(power.current == Approx(125.85671685040634));
+
+    for (double const fieldPower : {20.0, 80.0, 150.0}) {
+        auto const expected = MotorShaftPower(200, fieldPower, 1780, Motor::LineFrequency::FREQ60,
+                                              Motor::EfficiencyClass::SPECIFIED, 95, 460, 225, 480,
+                                              Motor::LoadEstimationMethod::POWER, 0).calculate();
+        auto const shared = MotorShaftPower(curves, fieldPower, 480, Motor::LoadEstimationMethod::POWER, 0).calculate();
+        CHECK(shared.shaftPower == expected.shaftPower);
+        CHECK(shared.loadFactor == expected.loadFactor);
+    }
+
+    for (double const fieldCurrent : {60.0, 125.857, 240.0}) {
+        auto const expected = MotorShaftPower(200, 0, 1780, Motor::LineFrequency::FREQ60,
+                                              Motor::EfficiencyClass::SPECIFIED, 95, 460, 225, 480,
+                                              Motor::LoadEstimationMethod::CURRENT, fieldCurrent).calculate();
+        auto const shared = MotorShaftPower(curves, 0, 480, Motor::LoadEstimationMethod::CURRENT, fieldCurrent).calculate();
+        CHECK(shared.shaftPower == expected.shaftPower);
+        CHECK(shared.loadFactor == expected.loadFactor);
+    }
+
+    auto const expected = OptimalMotorPower(200, 1780, Motor::LineFrequency::FREQ60, Motor::EfficiencyClass::SPECIFIED,
+                                            95, 460, 480, 101.5).calculate();
+    auto const shared = OptimalMotorPower(curves, 480, 101.5).calculate();
+    CHECK(shared.power == expected.power);
+    CHECK(shared.current == expected.current);
+    CHECK(shared.loadFactor == expected.loadFactor);
+}
+
+TEST_CASE( "Motor load bisection matches the 1% load stepping", "[MotorCurveSet]" ) {
+    auto const bisection = Motor::LoadSolver::BISECTION;
+    auto const ee = Motor::EfficiencyClass::ENERGY_EFFICIENT;
+    auto const specified = Motor::EfficiencyClass::SPECIFIED;
+    MotorCurveSet const curveSets[] = {
+            {Motor::LineFrequency::FREQ60, 1780, specified, 200, 95, 460, 225},
+            {Motor::LineFrequency::FREQ60, 1185, ee, 350, 0, 2300, 83},
+            {Motor::LineFrequency::FREQ50, 2960, Motor::EfficiencyClass::PREMIUM, 20, 0, 400, 27},
+    };
+
+    auto const checkSame = [](MotorShaftPower::Output const & a, MotorShaftPower::Output const & b) {
+        CHECK(a.shaftPower == b.shaftPower);
+        CHECK(a.current == b.current);
+        CHECK(a.powerFactor == b.powerFactor);
+        CHECK(a.efficiency == b.efficiency);
+        CHECK(a.power == b.power);
+        CHECK(a.estimatedFLA == b.estimatedFLA);
+        CHECK(a.loadFactor == b.loadFactor);
+    };
+
+    for (auto const & curves : curveSets) {
+        double const ratedkW = curves.getMotorRatedPower() * 0.746;
+        double const voltage = curves.getRatedVoltage() * 1.04;
+        for (int i = 3; i <= 171; i += 7) {
+            // from below the 25% load fit to beyond 150% load
+            double const fieldPower = ratedkW * i / 100.0;
+            double const fieldCurrent = curves.getFullLoadAmps() * i / 100.0;
+
+            checkSame(MotorShaftPower(curves, fieldPower, voltage, Motor::LoadEstimationMethod::POWER, 0).calculate(),
+                      MotorShaftPower(curves, fieldPower, voltage, Motor::LoadEstimationMethod::POWER, 0,
+                                      bisection).calculate());
+            checkSame(MotorShaftPower(curves, 0, voltage, Motor::LoadEstimationMethod::CURRENT, fieldCurrent).calculate(),
+                      MotorShaftPower(curves, 0, voltage, Motor::LoadEstimationMethod::CURRENT, fieldCurrent,
+                                      bisection).calculate());
+
+            double const shaftPower = curves.getMotorRatedPower() * i / 100.0;
+            auto const stepped = OptimalMotorPower(curves, voltage, shaftPower).calculate();
+            auto const bisected = OptimalMotorPower(curves, voltage, shaftPower, bisection).calculate();
+            CHECK(stepped.power == bisected.power);
+            CHECK(stepped.efficiency == bisected.efficiency);
+            CHECK(stepped.current == bisected.current);
+            CHECK(stepped.powerFactor == bisected.powerFactor);
+            CHECK(stepped.loadFactor == bisected.loadFactor);
+        }
+    }
+
+    auto const fromNameplate = MotorShaftPower(200, 80, 1780, Motor::LineFrequency::FREQ60, specified, 95, 460, 225, 480,
+                                               Motor::LoadEstimationMethod::POWER, 125.857, bisection).calculate();
+    CHECK(fromNameplate.shaftPower == Approx(101.18747791246317));
+    CHECK(fromNameplate.current == Approx(125.85671685040634));
+}
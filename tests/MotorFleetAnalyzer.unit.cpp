@@ -0,0 +1,112 @@
+#include "catch.hpp"
+#include <calculator/motor/MotorFleetAnalyzer.h>
+#include <calculator/motor/MotorEfficiency.h>
+#include <calculator/motor/EstimateFLA.h>
+
+namespace {
+    std::vector<MotorData> catalog() {
+        auto const fq60 = Motor::LineFrequency::FREQ60;
+        auto const ee = Motor::EfficiencyClass::ENERGY_EFFICIENT;
+        auto const pe = Motor::EfficiencyClass::PREMIUM;
+        return {
+                {75, 1800, 4, 95.4, ee, "Table 12-11", "TEFC", fq60, 600, "NEMA MG - 1"},
+                {100, 1800, 4, 95.4, ee, "Table 12-11", "TEFC", fq60, 600, "NEMA MG - 1"},
+                {125, 1800, 4, 95.4, ee, "Table 12-11", "TEFC", fq60, 600, "NEMA MG - 1"},
+                {150, 1800, 4, 96.2, pe, "Table 12-12", "TEFC", fq60, 600, "NEMA MG - 1"},
+                {200, 1800, 4, 96.2, pe, "Table 12-12", "TEFC", fq60, 600, "NEMA MG - 1"},
+                {150, 3600, 2, 95.8, pe, "Table 12-12", "TEFC", fq60, 600, "NEMA MG - 1"},
+                {150, 1500, 4, 96.0, pe, "Table 12-12", "TEFC", Motor::LineFrequency::FREQ50, 600, "IEC"},
+                {150, 1800, 4, 95.8, pe, "Table 12-12", "TEFC", fq60, 5000, "NEMA MG - 1"},
+        };
+    }
+}
+
+TEST_CASE( "MotorFleetAnalyzer ranks catalog replacements", "[MotorFleetAnalyzer]" ) {
+    auto const fq60 = Motor::LineFrequency::FREQ60;
+    std::vector<MotorFleetAnalyzer::LoadPoint> const profile = {{0.5, 0.4}, {0.65, 0.5}, {0, 0.1}};
+    MotorFleetAnalyzer::InstalledMotor const motor(fq60, 1780, Motor::EfficiencyClass::STANDARD, 150, 0, 460, profile,
+                                                   8760, 0.06);
+    MotorFleetAnalyzer const analyzer(catalog(), 15);
+    auto const output = analyzer.calculate(motor);
+
+    auto const energy = [&profile](double ratedPower, double loadRatedPower, MotorEfficiency motorEfficiency,
+                                   double specifiedEfficiency) {
+        double kWh = 0;
+        for (auto const & point : profile) {
+            if (point.loadFactor > 0) {
+                double const shaftPower = loadRatedPower * point.loadFactor;
+                kWh += shaftPower * 0.746 / motorEfficiency.calculate(shaftPower / ratedPower, specifiedEfficiency)
+                       * point.hoursFraction * 8760;
+            }
+        }
+        return kWh / 1000;
+    };
+
+    double const existingEnergy = energy(150, 150, MotorEfficiency(fq60, 1780, Motor::EfficiencyClass::STANDARD, 150), 0);
+    CHECK(output.annualEnergy == Approx(existingEnergy));
+    CHECK(output.annualCost == Approx(existingEnergy * 1000 * 0.06));
+    CHECK(output.estimatedFLA == Approx(EstimateFLA(150, 1780, fq60, Motor::EfficiencyClass::STANDARD, 0, 460).getEstimatedFLA()));
+    // 97.5 hp peak shaft power with a 15% margin
+    CHECK(output.optimalMotorRatedPower == 125);
+
+    // too small, other speeds and line frequency are not candidates; the 5000 V limit motor is
+    REQUIRE(output.candidates.size() == 4);
+    for (std::size_t i = 0; i < output.candidates.size(); ++i) {
+        auto const & candidate = output.candidates[i];
+        auto const & data = analyzer.getCatalog()[candidate.catalogIndex];
+        CHECK(candidate.motorRatedPower == data.getHp());
+        CHECK(candidate.peakLoadFactor == Approx(97.5 / data.getHp()));
+        double const candidateEnergy = energy(data.getHp(), 150, MotorEfficiency(fq60, 1800,
+                                              Motor::EfficiencyClass::SPECIFIED, data.getHp()), data.getNominalEfficiency());
+        CHECK(candidate.annualEnergy == Approx(candidateEnergy));
+        CHECK(candidate.annualSavings == Approx(output.annualCost - candidateEnergy * 1000 * 0.06));
+        CHECK(candidate.estimatedFLA == Approx(EstimateFLA(data.getHp(), 1800, fq60, Motor::EfficiencyClass::SPECIFIED,
+                                                           data.getNominalEfficiency(), 460).getEstimatedFLA()));
+        if (i > 0) {
+            CHECK(candidate.annualSavings <= output.candidates[i - 1].annualSavings);
+        }
+    }
+    CHECK(output.candidates.front().annualSavings > 0);
+
+    auto const best = MotorFleetAnalyzer(catalog(), 15, 2).calculate(motor);
+    REQUIRE(best.candidates.size() == 2);
+    CHECK(best.candidates[0].catalogIndex == output.candidates[0].catalogIndex);
+    CHECK(best.candidates[1].catalogIndex == output.candidates[1].catalogIndex);
+
+    // only the 150 hp catalog motor with the 5000 V limit is rated for 2300 V
+    MotorFleetAnalyzer::InstalledMotor const mediumVoltage(fq60, 1780, Motor::EfficiencyClass::STANDARD, 150, 0, 2300,
+                                                           profile, 8760, 0.06);
+    auto const mediumVoltageOutput = analyzer.calculate(mediumVoltage);
+    REQUIRE(mediumVoltageOutput.candidates.size() == 1);
+    CHECK(mediumVoltageOutput.candidates[0].catalogIndex == 7);
+
+    auto noEfficiency = catalog();
+    noEfficiency.push_back({100, 1800, 4, 0, Motor::EfficiencyClass::ENERGY_EFFICIENT, "Table 12-11", "TEFC",
+                            fq60, 600, "NEMA MG - 1"});
+    CHECK_THROWS_AS(MotorFleetAnalyzer(noEfficiency, 15), const std::runtime_error &);
+}
+
+TEST_CASE( "MotorFleetAnalyzer threads match serial evaluation", "[MotorFleetAnalyzer]" ) {
+    std::vector<MotorFleetAnalyzer::InstalledMotor> fleet;
+    for (int i = 0; i < 37; ++i) {
+        double const load = 0.3 + 0.02 * i;
+        std::vector<MotorFleetAnalyzer::LoadPoint> profile = {{load, 0.7}, {load * 0.6, 0.3}};
+        auto const efficiencyClass = i % 2 ? Motor::EfficiencyClass::STANDARD : Motor::EfficiencyClass::ENERGY_EFFICIENT;
+        fleet.emplace_back(Motor::LineFrequency::FREQ60, i % 3 ? 1780 : 3560, efficiencyClass, i % 4 ? 150 : 200, 0,
+                           460, profile, 6000 + 50 * i, 0.08);
+    }
+
+    auto const serial = MotorFleetAnalyzer(catalog(), 10, 0, 1).calculate(fleet);
+    auto const threaded = MotorFleetAnalyzer(catalog(), 10, 0, 4).calculate(fleet);
+    REQUIRE(serial.size() == fleet.size());
+    REQUIRE(threaded.size() == fleet.size());
+    for (std::size_t i = 0; i < fleet.size(); ++i) {
+        CHECK(threaded[i].annualEnergy == serial[i].annualEnergy);
+        CHECK(threaded[i].optimalMotorRatedPower == serial[i].optimalMotorRatedPower);
+        REQUIRE(threaded[i].candidates.size() == serial[i].candidates.size());
+        for (std::size_t j = 0; j < serial[i].candidates.size(); ++j) {
+            CHECK(threaded[i].candidates[j].catalogIndex == serial[i].candidates[j].catalogIndex);
+            CHECK(threaded[i].candidates[j].annualSavings == serial[i].candidates[j].annualSavings);
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include <algorithm>
+#include <calculator/motor/MotorLoadProfileEnergy.h>
+#include <calculator/motor/MotorShaftPower.h>
+
+TEST_CASE( "MotorLoadProfileEnergy over a power histogram", "[MotorLoadProfileEnergy]" ) {
+    MotorCurveSet const curves(Motor::LineFrequency::FREQ60, 1780, Motor::EfficiencyClass::SPECIFIED, 200, 95, 460,
+                               225);
+    auto const power = Motor::LoadEstimationMethod::POWER;
+    std::vector<MotorLoadProfileEnergy::Bin> const histogram = {{40, 1000}, {80, 4000}, {120, 2500}, {0, 1260}};
+    auto const output = MotorLoadProfileEnergy(curves, 480, power).calculate(histogram);
+
+    double inputEnergy = 0, shaftEnergy = 0, loadHours = 0, peakLoadFactor = 0;
+    for (auto const & bin : histogram) {
+        if (bin.measurement > 0) {
+            auto const point = MotorShaftPower(curves, bin.measurement, 480, power, 0).calculate();
+            inputEnergy += point.power * bin.hours / 1000;
+            shaftEnergy += point.shaftPower * 0.746 * bin.hours / 1000;
+            loadHours += point.loadFactor * bin.hours;
+            peakLoadFactor = std::max(peakLoadFactor, point.loadFactor);
+        }
+    }
+
+    CHECK(output.totalHours == 8760);
+    CHECK(output.operatingHours == 7500);
+    CHECK(output.inputEnergy == Approx(inputEnergy));
+    CHECK(output.inputEnergy == Approx((40 * 1000 + 80 * 4000 + 120 * 2500) / 1000.0));
+    CHECK(output.shaftEnergy == Approx(shaftEnergy));
+    CHECK(output.lossEnergy == Approx(inputEnergy - shaftEnergy));
+    CHECK(output.averageLoadFactor == Approx(loadHours / 7500));
+    CHECK(output.peakLoadFactor == Approx(peakLoadFactor));
+    CHECK(output.averageEfficiency == Approx(shaftEnergy / inputEnergy));
+    CHECK(output.averageEfficiency > 0.9);
+}
+
+TEST_CASE( "MotorLoadProfileEnergy over an hourly current series", "[MotorLoadProfileEnergy]" ) {
+    MotorCurveSet const curves(Motor::LineFrequency::FREQ60, 1185, Motor::EfficiencyClass::ENERGY_EFFICIENT, 350, 0,
+                               2300, 83);
+    auto const current = Motor::LoadEstimationMethod::CURRENT;
+    std::vector<double> series;
+    for (int hour = 0; hour < 8760; ++hour) {
+        // a daily cycle, off for two hours a day
+        int const hourOfDay = hour % 24;
+        series.push_back(hourOfDay < 2 ? 0 : 40 + 2 * hourOfDay);
+    }
+    MotorLoadProfileEnergy const profile(curves, 2400, current);
+    auto const output = profile.calculate(series);
+
+    double inputEnergy = 0, shaftEnergy = 0;
+    for (int hourOfDay = 2; hourOfDay < 24; ++hourOfDay) {
+        auto const point = MotorShaftPower(curves, 0, 2400, current, 40 + 2 * hourOfDay).calculate();
+        inputEnergy += point.power * 365 / 1000;
+        shaftEnergy += point.shaftPower * 0.746 * 365 / 1000;
+    }
+    CHECK(output.totalHours == 8760);
+    CHECK(output.operatingHours == 22 * 365);
+    CHECK(output.inputEnergy == Approx(inputEnergy));
+    CHECK(output.shaftEnergy == Approx(shaftEnergy));
+
+    // the same series as a quarter hourly series is a quarter of the energy
+    auto const quarterHourly = profile.calculate(series, 0.25);
+    CHECK(quarterHourly.inputEnergy == Approx(inputEnergy / 4));
+    CHECK(quarterHourly.averageLoadFactor == Approx(output.averageLoadFactor));
+
+    // stepping finds the same loads as bisection
+    auto const stepped = MotorLoadProfileEnergy(curves, 2400, current, Motor::LoadSolver::STEP).calculate(series);
+    CHECK(stepped.inputEnergy == Approx(output.inputEnergy));
+    CHECK(stepped.averageLoadFactor == Approx(output.averageLoadFactor));
+
+    auto const off = profile.calculate(std::vector<double>(24, 0));
+    CHECK(off.operatingHours == 0);
+    CHECK(off.inputEnergy == 0);
+    CHECK(off.averageEfficiency == 0);
+}
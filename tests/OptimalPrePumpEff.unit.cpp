@@ -0,0 +1,85 @@
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+#include <calculator/pump/OptimalPrePumpEff.h>
+
+namespace {
+    // the prepump efficiency as calculated before the coefficient table kernels, one switch case per style
+    double reference(const Pump::Style style, const double q) {
+        auto const curve = [q](double c0, double c1, double c2, double c3, double c4) {
+            return c0 + (c1 * std::exp(-c2 * q) + c3 * std::exp(-c4 * q));
+        };
+        switch (style) {
+            case Pump::Style::DOUBLE_SUCTION:
+                return q < 9000 ? curve(90.190375, -7.8068742, 0.00033366482, -8.1364684, 0.0026659434)
+                                : curve(91.0, -3.6664629, 0.0001264433, -14.697275, 0.00072855045);
+            case Pump::Style::VERTICAL_TURBINE:
+            case Pump::Style::AXIAL_FLOW:
+                if (q < 2550) return curve(87.456119, -9.3556039, 0.00067139092, -9.4309496, 0.0039344122);
+                if (q < 7220) return curve(89.899894, -5.9800814, 0.00019480643, -7.0638099, 0.0010440162);
+                return curve(90.124016, -1.7332611, 0.00014953651, -3.3197451, 0.00015232542);
+            case Pump::Style::LARGE_END_SUCTION:
+                return curve(90.379274, -3.000737, 0.000034054964, -4.818246, 0.00019083831);
+            case Pump::Style::END_SUCTION_ANSI_API:
+                return q < 1030 ? curve(84.655455, -18.706336, 0.0016056629, -20.655962, 0.0081197589)
+                                : curve(87.748473, -7.6842423, 0.0003739105, -17.336122, 0.0024096967);
+            case Pump::Style::MULTISTAGE_BOILER_FEED:
+                return q < 890 ? curve(84.286574, -17.836167, 0.0013236525, -26.951966, 0.0068256307)
+                               : curve(87.129684, -7.8144274, 0.00034998448, -19.605637, 0.0022387671);
+            case Pump::Style::END_SUCTION_STOCK:
+            case Pump::Style::API_DOUBLE_SUCTION:
+                return q < 4440 ? curve(87.199887, -10.580842, 0.00027878405, -23.785033, 0.0018831236)
+                                : curve(90.158464, -4.8350009, 0.000048652395, -7.2881572, 0.00027630687);
+            case Pump::Style::END_SUCTION_SEWAGE:
+            case Pump::Style::END_SUCTION_SUBMERSIBLE_SEWAGE:
+                return q < 2170 ? curve(83.528143, -23.543231, 0.00071315587, -37.584938, 0.005809375)
+                                : curve(89.704526, -6.9708815, 0.000057096295, -13.868089, 0.00046766436);
+            case Pump::Style::END_SUCTION_SLURRY:
+                return q < 1690 ? curve(79.096487, -32.006283, 0.00084199445, -23.100062, 0.0064912714)
+                                : curve(85.957484, -15.256678, 0.00017627657, -24.920847, 0.0012055457);
+            case Pump::Style::SPECIFIED_OPTIMAL_EFFICIENCY:
+                return 0;
+        }
+        return 0;
+    }
+}
+
+TEST_CASE( "Optimal prepump efficiency", "[optimal][OptimalPrePumpEff]" ) {
+    CHECK( OptimalPrePumpEff(Pump::Style::END_SUCTION_ANSI_API, 2000).calculate() == Approx( 83.97084437955112 ).epsilon(1e-9) );
+    CHECK( OptimalPrePumpEff(Pump::Style::VERTICAL_TURBINE, 8000).calculate() == Approx( 88.61856979506354 ).epsilon(1e-9) );
+    CHECK( OptimalPrePumpEff(Pump::Style::SPECIFIED_OPTIMAL_EFFICIENCY, 2000).calculate() == 0 );
+}
+
+TEST_CASE( "Optimal prepump efficiency array kernels", "[optimal][OptimalPrePumpEff][batch]" ) {
+    std::vector<double> flowRates;
+    for (double q = 10; q <= 20000; q += 10) {
+        flowRates.push_back(q);
+    }
+    // the range limits themselves
+    for (double q : {890.0, 1030.0, 1690.0, 2170.0, 2550.0, 4440.0, 7220.0, 9000.0}) {
+        flowRates.push_back(q);
+        flowRates.push_back(std::nextafter(q, 0.0));
+    }
+    std::size_t const count = flowRates.size();
+
+    std::vector<Pump::Style> mixedStyles(count);
+    int const styleCount = static_cast<int>(Pump::Style::SPECIFIED_OPTIMAL_EFFICIENCY) + 1;
+    for (int s = 0; s < styleCount; ++s) {
+        auto const style = static_cast<Pump::Style>(s);
+        std::vector<double> efficiencies(count);
+        OptimalPrePumpEff::calculate(style, flowRates.data(), efficiencies.data(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            CHECK( efficiencies[i] == reference(style, flowRates[i]) );
+            CHECK( OptimalPrePumpEff(style, flowRates[i]).calculate() == efficiencies[i] );
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        mixedStyles[i] = static_cast<Pump::Style>(i % styleCount);
+    }
+    std::vector<double> efficiencies(count);
+    OptimalPrePumpEff::calculate(mixedStyles.data(), flowRates.data(), efficiencies.data(), count);
+    for (std::size_t i = 0; i < count; ++i) {
+        CHECK( efficiencies[i] == reference(mixedStyles[i], flowRates[i]) );
+    }
+}
@@ -0,0 +1,65 @@
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+#include <calculator/pump/OptimalPumpEfficiency.h>
+#include <calculator/pump/OptimalPrePumpEff.h>
+#include <calculator/pump/OptimalSpecificSpeed.h>
+#include <calculator/pump/OptimalSpecificSpeedCorrection.h>
+#include <calculator/pump/OptimalDeviationFactor.h>
+
+namespace {
+    // the optimal pump efficiency as calculated before the batch kernel, with pow for the fractional exponents
+    double reference(Pump::Style style, double rpm, double kinematicViscosity, double stageCount, double flowRate,
+                     double head) {
+        double const prePumpEfficiency = OptimalPrePumpEff(style, flowRate).calculate();
+        double const parameterB = 26.6 * (std::pow(kinematicViscosity, 0.5) * std::pow(head, 0.0625))
+                                  / (std::pow(flowRate, 0.375) * std::pow(rpm, 0.25));
+        double const viscosityCorrectionFactor = std::fmin(1, std::pow(parameterB, -(0.0547 * std::pow(parameterB, 0.69))));
+        double const specificSpeed = OptimalSpecificSpeed(rpm, flowRate, head, stageCount).calculate();
+        double const speedCorrection = OptimalSpecificSpeedCorrection(style, specificSpeed).calculate();
+        double const positiveDeviationFactor = OptimalDeviationFactor(flowRate).calculate();
+        return (prePumpEfficiency / 100 * viscosityCorrectionFactor - speedCorrection) * positiveDeviationFactor;
+    }
+}
+
+TEST_CASE( "Optimal pump efficiency", "[optimal][OptimalPumpEfficiency]" ) {
+    auto const style = Pump::Style::END_SUCTION_ANSI_API;
+    double const expected = reference(style, 1780, 1, 1, 2000, 277);
+    CHECK( OptimalPumpEfficiency(style, 0, 1780, 1, 1, 2000, 277).calculate() == Approx( expected ).epsilon(1e-12) );
+    CHECK( OptimalPumpEfficiency(style, 0, 1780, 1, 1, 2000, 277).calculate() == Approx( 0.8504382865282737 ).epsilon(1e-9) );
+}
+
+TEST_CASE( "Optimal pump efficiency batch", "[optimal][OptimalPumpEfficiency][batch]" ) {
+    std::vector<double> flowRates, heads, rpms;
+    for (double const rpm : {1180.0, 1780.0, 3560.0}) {
+        for (double flowRate = 50; flowRate <= 12000; flowRate *= 1.7) {
+            for (double head = 20; head <= 1200; head *= 2.1) {
+                flowRates.push_back(flowRate);
+                heads.push_back(head);
+                rpms.push_back(rpm);
+            }
+        }
+    }
+    // more than one block, and a speed change inside a block
+    REQUIRE( flowRates.size() > 128 );
+    std::size_t const count = flowRates.size();
+
+    int const styleCount = static_cast<int>(Pump::Style::SPECIFIED_OPTIMAL_EFFICIENCY) + 1;
+    for (int s = 0; s < styleCount; ++s) {
+        auto const style = static_cast<Pump::Style>(s);
+        for (double const kinematicViscosity : {1.0, 50.0, 500.0}) {
+            for (double const stageCount : {1.0, 3.0}) {
+                std::vector<double> efficiencies(count);
+                OptimalPumpEfficiency::calculate(style, kinematicViscosity, stageCount, flowRates.data(), heads.data(),
+                                                 rpms.data(), efficiencies.data(), count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    double const expected = reference(style, rpms[i], kinematicViscosity, stageCount, flowRates[i],
+                                                      heads[i]);
+                    CHECK( efficiencies[i] == Approx( expected ).epsilon(1e-12).margin(1e-12) );
+                    CHECK( OptimalPumpEfficiency(style, 0, rpms[i], kinematicViscosity, stageCount, flowRates[i],
+                                                 heads[i]).calculate() == efficiencies[i] );
+                }
+            }
+        }
+    }
+}
@@ -1,4 +1,6 @@
 #include "catch.hpp"
+#include <cmath>
+#include <vector>
 #include <calculator/pump/OptimalSpecificSpeedCorrection.h>
 
 TEST_CASE( "Calculate Optimal Specific Speed Correction NotVTP", "[optimal][SpecificSpeedCorrection][NotVTP]" ) {
@@ -636,3 +638,54 @@ TEST_CASE( "Calculate Optimal Specific Speed Correction VTP", "[optimal][Specifi
     CHECK( OptimalSpecificSpeedCorrection(Pump::Style::VERTICAL_TURBINE, 16350).calculate() == Approx( 0.029078707 ) );
 
 }
+
+TEST_CASE( "Optimal Specific Speed Correction array kernels", "[optimal][SpecificSpeedCorrection][batch]" ) {
+    // the polynomials as evaluated before the Horner form kernels, term by term with pow
+    auto const reference = [](const Pump::Style style, const double ns) {
+        const double notVTP[7][2] = {{14.884085, 6.5703317}, {-0.021342141, -0.010048327},
+                                     {0.0000121172, 0.0000061475098}, {-0.0000000031885957, -0.0000000019659725},
+                                     {1.4907927E-13, 3.5079978E-13}, {1.2855352E-16, -3.2272033E-17},
+                                     {-2.3798184E-20, 1.1881188E-21}};
+        const double VTP[7][2] = {{14.788539, 4.0559384}, {-0.022490348, -0.0026632249},
+                                  {0.000017226359, 0.0000006761157}, {-0.0000000075690542, -0.000000000087766773},
+                                  {1.8893534E-12, 6.5103425E-15}, {-2.4834106E-16, -2.5380141E-19},
+                                  {1.3345507E-20, 4.007753E-24}};
+        bool const vtp = style == Pump::Style::VERTICAL_TURBINE;
+        std::size_t const index = ns < (vtp ? 4550 : 2530) ? 0 : 1;
+        double sum = 0;
+        for (int k = 0; k < 7; ++k) {
+            sum += (vtp ? VTP : notVTP)[k][index] * std::pow(ns, k);
+        }
+        return std::fmax(sum, 0) / 100;
+    };
+
+    std::vector<double> specificSpeeds;
+    for (double ns = 200; ns <= 20000; ns += 35) {
+        specificSpeeds.push_back(ns);
+    }
+    std::size_t const count = specificSpeeds.size();
+
+    std::vector<Pump::Style> styles;
+    for (int s = 0; s <= static_cast<int>(Pump::Style::SPECIFIED_OPTIMAL_EFFICIENCY); ++s) {
+        auto const style = static_cast<Pump::Style>(s);
+        std::vector<double> corrections(count);
+        OptimalSpecificSpeedCorrection::calculate(style, specificSpeeds.data(), corrections.data(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            double const expected = reference(style, specificSpeeds[i]);
+            CHECK( corrections[i] == Approx( expected ).margin(1e-12) );
+            CHECK( OptimalSpecificSpeedCorrection(style, specificSpeeds[i]).calculate() == corrections[i] );
+        }
+        styles.push_back(style);
+    }
+
+    // one pump of each style per specific speed
+    std::vector<Pump::Style> mixedStyles(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        mixedStyles[i] = styles[i % styles.size()];
+    }
+    std::vector<double> corrections(count);
+    OptimalSpecificSpeedCorrection::calculate(mixedStyles.data(), specificSpeeds.data(), corrections.data(), count);
+    for (std::size_t i = 0; i < count; ++i) {
+        CHECK( corrections[i] == OptimalSpecificSpeedCorrection(mixedStyles[i], specificSpeeds[i]).calculate() );
+    }
+}
@@ -0,0 +1,87 @@
+#include "catch.hpp"
+#include <cmath>
+#include <calculator/pump/PumpSystemOperatingPoint.h>
+#include <calculator/pump/OptimalPumpShaftPower.h>
+#include <calculator/motor/OptimalMotorShaftPower.h>
+#include <calculator/motor/OptimalMotorPower.h>
+
+namespace {
+    // H = 100 - 2e-5 Q^2, eta = 8e-4 Q - 2e-7 Q^2 at 1780 rpm
+    PumpCurve polynomialCurve() {
+        return {1780, {100, 0, -2e-5}, {0, 8e-4, -2e-7}, 2000};
+    }
+}
+
+TEST_CASE( "Pump and system curve intersection at variable speed", "[PumpSystemOperatingPoint]" ) {
+    MotorCurveSet const motor(Motor::LineFrequency::FREQ60, 1780, Motor::EfficiencyClass::ENERGY_EFFICIENT, 40, 0, 460, 0);
+    SystemCurve const system(40, 1e-5);
+    PumpSystemOperatingPoint const solver(polynomialCurve(), system, 1, Motor::Drive::N_V_BELT_DRIVE, 1, motor, 460);
+
+    auto const outputs = solver.calculate({1780, 1500, 1200, 1000});
+    REQUIRE(outputs.size() == 4);
+    for (auto const & output : outputs) {
+        double const r = output.speed / 1780;
+        INFO("speed " << output.speed);
+        if (100 * r * r <= 40) {
+            CHECK(output.flowRate == 0);
+            CHECK(output.head == Approx(100 * r * r));
+            CHECK(output.motorPower == 0);
+            continue;
+        }
+        double const flowRate = std::sqrt((100 * r * r - 40) / 3e-5);
+        double const q = flowRate / r;
+        CHECK(output.flowRate == Approx(flowRate).epsilon(1e-10));
+        CHECK(output.head == Approx(40 + 1e-5 * flowRate * flowRate).epsilon(1e-10));
+        CHECK(output.pumpEfficiency == Approx(8e-4 * q - 2e-7 * q * q).epsilon(1e-10));
+
+        double const pumpShaftPower = OptimalPumpShaftPower(output.flowRate, output.head, 1, output.pumpEfficiency).calculate();
+        auto const shaft = OptimalMotorShaftPower(pumpShaftPower, Motor::Drive::N_V_BELT_DRIVE, 1).calculate();
+        auto const power = OptimalMotorPower(motor, 460, shaft.motorShaftPower, Motor::LoadSolver::BISECTION).calculate();
+        CHECK(output.pumpShaftPower == Approx(pumpShaftPower));
+        CHECK(output.motorShaftPower == Approx(shaft.motorShaftPower));
+        CHECK(output.driveEfficiency == Approx(shaft.driveEfficiency));
+        CHECK(output.motorEfficiency == Approx(power.efficiency));
+        CHECK(output.loadFactor == Approx(power.loadFactor));
+        CHECK(output.motorPower == Approx(power.power));
+    }
+    CHECK(outputs[0].flowRate == Approx(std::sqrt(2e6)));
+    CHECK(outputs[0].motorPower > outputs[1].motorPower);
+    CHECK(outputs[1].motorPower > outputs[2].motorPower);
+    CHECK(outputs[3].flowRate == 0);
+
+    // the system curve is still below the pump curve at the end of the curve
+    PumpSystemOperatingPoint const flat(polynomialCurve(), SystemCurve(0, 1e-6), 1, Motor::Drive::DIRECT_DRIVE, 1, motor, 460);
+    CHECK_THROWS_AS(flat.calculate(1780), const std::runtime_error &);
+    CHECK_THROWS_AS(solver.calculate(0), const std::runtime_error &);
+}
+
+TEST_CASE( "Tabulated pump curve operating point", "[PumpSystemOperatingPoint]" ) {
+    MotorCurveSet const motor(Motor::LineFrequency::FREQ60, 1780, Motor::EfficiencyClass::ENERGY_EFFICIENT, 40, 0, 460, 0);
+    auto const polynomial = polynomialCurve();
+    std::vector<PumpCurve::Point> points;
+    for (double q = 0; q <= 2000; q += 100) {
+        points.push_back({q, polynomial.head(q), polynomial.efficiency(q)});
+    }
+    PumpCurve const tabulated(1780, points);
+    CHECK(tabulated.head(1000) == Approx(80));
+    CHECK(tabulated.head(1050) == Approx((polynomial.head(1000) + polynomial.head(1100)) / 2));
+    CHECK(tabulated.efficiency(1050) == Approx((polynomial.efficiency(1000) + polynomial.efficiency(1100)) / 2));
+    CHECK(tabulated.headSlope(1050) == Approx((polynomial.head(1100) - polynomial.head(1000)) / 100));
+    CHECK(tabulated.head(2100) == Approx(polynomial.head(2000) + (polynomial.head(2000) - polynomial.head(1900))));
+
+    SystemCurve const system(40, 1e-5);
+    PumpSystemOperatingPoint const exact(polynomial, system, 1, Motor::Drive::DIRECT_DRIVE, 1, motor, 460);
+    PumpSystemOperatingPoint const solver(tabulated, system, 1, Motor::Drive::DIRECT_DRIVE, 1, motor, 460);
+    for (double speed = 1200; speed <= 1780; speed += 20) {
+        double const r = speed / 1780;
+        double const flowRate = solver.intersect(r);
+        // linear interpolation between points 100 gpm apart
+        CHECK(flowRate == Approx(exact.intersect(r)).epsilon(2e-3));
+        CHECK(r * r * tabulated.head(flowRate / r) == Approx(system.head(flowRate)).epsilon(1e-10));
+    }
+
+    CHECK_THROWS_AS(PumpCurve(1780, {{0, 100, 0}}), const std::runtime_error &);
+    CHECK_THROWS_AS(PumpCurve(1780, {{100, 90, 0.5}, {200, 80, 0.6}}), const std::runtime_error &);
+    CHECK_THROWS_AS(PumpCurve(1780, {{0, 100, 0}, {200, 80, 0.6}, {200, 70, 0.7}}), const std::runtime_error &);
+    CHECK_THROWS_AS(PumpCurve(1780, {}, {0.5}, 2000), const std::runtime_error &);
+}
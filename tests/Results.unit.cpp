@@ -1,5 +1,7 @@
 #include "catch.hpp"
 #include <results/Results.h>
+#include <results/PSATBatch.h>
+#include <results/PSATSweep.h>
 #include <unordered_map>
 #include <calculator/pump/PumpShaftPower.h>
 #include <calculator/pump/MoverEfficiency.h>
@@ -364,6 +366,91 @@ TEST_CASE( "PSATResults sync belt", "[PSAT results]" ) {
 	CHECK(mod.motorPower == Approx(151.8722277599));
 }
 
+TEST_CASE( "PSATBatch matches PSATResult", "[PSAT results][PSATBatch]" ) {
+	auto const fq60 = Motor::LineFrequency::FREQ60;
+	auto const specified = Motor::EfficiencyClass::SPECIFIED;
+	Pump::Input const endSuction(Pump::Style::END_SUCTION_ANSI_API, 0.80, 1780, Motor::Drive::DIRECT_DRIVE, 1.0, 1.0, 2, Pump::SpecificSpeed::NOT_FIXED_SPEED, 1.0);
+	Pump::Input const vBelt(Pump::Style::END_SUCTION_STOCK, 0.382, 1185, Motor::Drive::V_BELT_DRIVE, 1.0, 0.99, 1, Pump::SpecificSpeed::NOT_FIXED_SPEED, 1.0);
+	Motor const motor200(fq60, 200, 1780, specified, 95, 460, 225.0);
+	Motor const motor350(fq60, 350, 1185, Motor::EfficiencyClass::ENERGY_EFFICIENT, 95, 2300, 83);
+
+	PSATBatch::Input input;
+	std::vector<PSATResult> results;
+	for (int i = 0; i < 12; ++i) {
+		bool const large = i % 3 == 0;
+		Pump::Input const & pump = large ? vBelt : endSuction;
+		Motor const & motor = large ? motor350 : motor200;
+		auto const method = i % 2 ? Motor::LoadEstimationMethod::CURRENT : Motor::LoadEstimationMethod::POWER;
+		Pump::FieldData const fieldData(1840 + 50 * i, 174.85 - 4 * i, method, (large ? 150 : 80) + 3 * i, (large ? 60 : 125.857) + i, large ? 2300 : 480);
+		input.add(pump, motor, fieldData, 8760, 0.05);
+		results.emplace_back(pump, motor, fieldData, 8760, 0.05);
+	}
+
+	for (auto const loadSolver : {Motor::LoadSolver::STEP, Motor::LoadSolver::BISECTION}) {
+		auto const batch = PSATBatch(loadSolver).calculate(input);
+		CHECK(batch.motorGroupCount == 2);
+		REQUIRE(batch.existing.size() == results.size());
+		REQUIRE(batch.modified.size() == results.size());
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			auto const ex = results[i].calculateExisting();
+			CHECK(batch.existing.motorShaftPower[i] == ex.motorShaftPower);
+			CHECK(batch.existing.pumpEfficiency[i] == ex.pumpEfficiency);
+			CHECK(batch.existing.motorCurrent[i] == ex.motorCurrent);
+			CHECK(batch.existing.motorPowerFactor[i] == ex.motorPowerFactor);
+			CHECK(batch.existing.annualCost[i] == ex.annualCost);
+			CHECK(batch.existing.estimatedFLA[i] == ex.estimatedFLA);
+
+			auto const mod = results[i].calculateModified();
+			CHECK(batch.modified.motorPower[i] == mod.motorPower);
+			CHECK(batch.modified.motorEfficiency[i] == mod.motorEfficiency);
+			CHECK(batch.modified.motorCurrent[i] == mod.motorCurrent);
+			CHECK(batch.modified.loadFactor[i] == mod.loadFactor);
+			CHECK(batch.modified.annualEnergy[i] == mod.annualEnergy);
+		}
+	}
+
+	input.head.pop_back();
+	CHECK_THROWS_AS(PSATBatch().calculate(input), const std::runtime_error &);
+}
+
+TEST_CASE( "PSATSweep matches PSATResult", "[PSAT results][PSATSweep]" ) {
+	Pump::Input const pump(Pump::Style::END_SUCTION_ANSI_API, 0.80, 1780, Motor::Drive::V_BELT_DRIVE, 1.0, 1.0, 2, Pump::SpecificSpeed::NOT_FIXED_SPEED, 1.0);
+	Motor const motor(Motor::LineFrequency::FREQ60, 200, 1780, Motor::EfficiencyClass::SPECIFIED, 95, 460, 225.0);
+	PSATSweep const sweep(pump, motor, 480, 8760, 0.05);
+
+	std::vector<double> const flowRates = {1200, 1840, 2400};
+	std::vector<double> const heads = {120, 174.85};
+	std::vector<double> const loadFactors = {0.3, 0.55, 0.8, 1.05};
+	auto const output = sweep.calculate(flowRates, heads, loadFactors);
+	REQUIRE(output.existing.size() == 24);
+	REQUIRE(output.modified.size() == 24);
+
+	for (std::size_t f = 0; f < flowRates.size(); ++f) {
+		for (std::size_t h = 0; h < heads.size(); ++h) {
+			for (std::size_t l = 0; l < loadFactors.size(); ++l) {
+				auto const i = output.index(f, h, l);
+				Pump::FieldData const fieldData(flowRates[f], heads[h], Motor::LoadEstimationMethod::POWER, output.motorPowers[l], 0, 480);
+				PSATResult psat(pump, motor, fieldData, 8760, 0.05);
+				auto const ex = psat.calculateExisting();
+				auto const mod = psat.calculateModified();
+				CHECK(output.existing[i].pumpEfficiency == ex.pumpEfficiency);
+				CHECK(output.existing[i].motorShaftPower == ex.motorShaftPower);
+				CHECK(output.existing[i].annualCost == ex.annualCost);
+				CHECK(output.existing[i].loadFactor == Approx(loadFactors[l]).epsilon(0.01));
+				CHECK(output.modified[i].motorPower == mod.motorPower);
+				CHECK(output.modified[i].annualCost == mod.annualCost);
+				CHECK(output.annualSavings(i) == ex.annualCost - mod.annualCost);
+			}
+		}
+	}
+
+	std::vector<double> weights(output.existing.size(), 0);
+	weights[output.index(1, 1, 2)] = 0.75;
+	weights[output.index(0, 1, 0)] = 0.25;
+	CHECK(output.weightedAnnualSavings(weights) == Approx(0.75 * output.annualSavings(output.index(1, 1, 2)) + 0.25 * output.annualSavings(output.index(0, 1, 0))));
+	CHECK_THROWS_AS(output.weightedAnnualSavings({1.0}), const std::runtime_error &);
+}
+
 TEST_CASE( "PSAT pump shaft power", "[PSAT][pump shaft power][drive]" ) {
 	CHECK(PumpShaftPower(50, Motor::Drive::N_V_BELT_DRIVE, 0).calculate().pumpShaftPower == Approx(48.4814329723));
 	CHECK(PumpShaftPower(100, Motor::Drive::N_V_BELT_DRIVE, 0).calculate().pumpShaftPower == Approx(97.0776282082));
@@ -540,3 +627,125 @@ TEST_CASE( "EstimateFLA", "[EstimateFLA]" ) {
 	t.calculate();
 	CHECK(t.getEstimatedFLA() == Approx(227.288340026));
 }
+
+TEST_CASE( "EstimateFLA batch", "[EstimateFLA]" ) {
+	struct Expected {
+		Motor::EfficiencyClass efficiencyClass;
+		double rpm, ratedPower, estimatedFLA;
+	};
+	// 2 to 12 poles at 60 Hz, 94% specified efficiency, 460 V; PE motors of more than 6 poles use the 6 pole PE
+	// multipliers
+	std::vector<Expected> const expected = {
+			{Motor::EfficiencyClass::STANDARD, 3560.0, 5.0, 6.387718704},
+			{Motor::EfficiencyClass::STANDARD, 3560.0, 50.0, 58.47254424},
+			{Motor::EfficiencyClass::STANDARD, 3560.0, 200.0, 224.4649955},
+			{Motor::EfficiencyClass::STANDARD, 3560.0, 1200.0, 1308.408172},
+			{Motor::EfficiencyClass::STANDARD, 1780.0, 5.0, 6.761371328},
+			{Motor::EfficiencyClass::STANDARD, 1780.0, 50.0, 60.38147468},
+			{Motor::EfficiencyClass::STANDARD, 1780.0, 200.0, 228.5727148},
+			{Motor::EfficiencyClass::STANDARD, 1780.0, 1200.0, 1317.318831},
+			{Motor::EfficiencyClass::STANDARD, 1185.0, 5.0, 7.731406377},
+			{Motor::EfficiencyClass::STANDARD, 1185.0, 50.0, 62.40529949},
+			{Motor::EfficiencyClass::STANDARD, 1185.0, 200.0, 237.7460036},
+			{Motor::EfficiencyClass::STANDARD, 1185.0, 1200.0, 1349.165386},
+			{Motor::EfficiencyClass::STANDARD, 880.0, 5.0, 9.039350795},
+			{Motor::EfficiencyClass::STANDARD, 880.0, 50.0, 66.28162209},
+			{Motor::EfficiencyClass::STANDARD, 880.0, 200.0, 253.6204298},
+			{Motor::EfficiencyClass::STANDARD, 880.0, 1200.0, 1453.892303},
+			{Motor::EfficiencyClass::STANDARD, 700.0, 5.0, 9.446121053},
+			{Motor::EfficiencyClass::STANDARD, 700.0, 50.0, 69.26428996},
+			{Motor::EfficiencyClass::STANDARD, 700.0, 200.0, 265.0333288},
+			{Motor::EfficiencyClass::STANDARD, 700.0, 1200.0, 1519.317334},
+			{Motor::EfficiencyClass::STANDARD, 590.0, 5.0, 9.762498651},
+			{Motor::EfficiencyClass::STANDARD, 590.0, 50.0, 71.58414932},
+			{Motor::EfficiencyClass::STANDARD, 590.0, 200.0, 273.9100539},
+			{Motor::EfficiencyClass::STANDARD, 590.0, 1200.0, 1570.203623},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 3560.0, 5.0, 5.913276884},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 3560.0, 50.0, 56.26180345},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 3560.0, 200.0, 219.9814248},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 3560.0, 1200.0, 1299.943102},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1780.0, 5.0, 6.30614191},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1780.0, 50.0, 58.1583707},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1780.0, 200.0, 225.8006123},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1780.0, 1200.0, 1314.768555},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1185.0, 5.0, 6.893183334},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1185.0, 50.0, 59.83755238},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1185.0, 200.0, 235.3150383},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 1185.0, 1200.0, 1341.102748},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 880.0, 5.0, 7.515679978},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 880.0, 50.0, 64.45562879},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 880.0, 200.0, 250.8858631},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 880.0, 1200.0, 1439.425713},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 700.0, 5.0, 7.853885138},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 700.0, 50.0, 67.3561271},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 700.0, 200.0, 262.1757068},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 700.0, 1200.0, 1504.199749},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 590.0, 5.0, 8.116934204},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 590.0, 50.0, 69.61207662},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 590.0, 200.0, 270.9567219},
+			{Motor::EfficiencyClass::ENERGY_EFFICIENT, 590.0, 1200.0, 1554.579706},
+			{Motor::EfficiencyClass::PREMIUM, 3560.0, 5.0, 5.856530323},
+			{Motor::EfficiencyClass::PREMIUM, 3560.0, 50.0, 55.97373963},
+			{Motor::EfficiencyClass::PREMIUM, 3560.0, 200.0, 217.7466875},
+			{Motor::EfficiencyClass::PREMIUM, 3560.0, 1200.0, 1270.222176},
+			{Motor::EfficiencyClass::PREMIUM, 1780.0, 5.0, 6.474448675},
+			{Motor::EfficiencyClass::PREMIUM, 1780.0, 50.0, 57.84330626},
+			{Motor::EfficiencyClass::PREMIUM, 1780.0, 200.0, 224.0381282},
+			{Motor::EfficiencyClass::PREMIUM, 1780.0, 1200.0, 1300.628012},
+			{Motor::EfficiencyClass::PREMIUM, 1185.0, 5.0, 6.933564135},
+			{Motor::EfficiencyClass::PREMIUM, 1185.0, 50.0, 60.08425738},
+			{Motor::EfficiencyClass::PREMIUM, 1185.0, 200.0, 233.6942125},
+			{Motor::EfficiencyClass::PREMIUM, 1185.0, 1200.0, 1330.962039},
+			{Motor::EfficiencyClass::PREMIUM, 880.0, 5.0, 7.866390268},
+			{Motor::EfficiencyClass::PREMIUM, 880.0, 50.0, 64.59996392},
+			{Motor::EfficiencyClass::PREMIUM, 880.0, 200.0, 249.7396845},
+			{Motor::EfficiencyClass::PREMIUM, 880.0, 1200.0, 1432.848742},
+			{Motor::EfficiencyClass::PREMIUM, 700.0, 5.0, 8.220377371},
+			{Motor::EfficiencyClass::PREMIUM, 700.0, 50.0, 67.5069573},
+			{Motor::EfficiencyClass::PREMIUM, 700.0, 200.0, 260.9779503},
+			{Motor::EfficiencyClass::PREMIUM, 700.0, 1200.0, 1497.326813},
+			{Motor::EfficiencyClass::PREMIUM, 590.0, 5.0, 8.495701309},
+			{Motor::EfficiencyClass::PREMIUM, 590.0, 50.0, 69.76795856},
+			{Motor::EfficiencyClass::PREMIUM, 590.0, 200.0, 269.7188492},
+			{Motor::EfficiencyClass::PREMIUM, 590.0, 1200.0, 1547.476577},
+			{Motor::EfficiencyClass::SPECIFIED, 3560.0, 5.0, 5.538634299},
+			{Motor::EfficiencyClass::SPECIFIED, 3560.0, 50.0, 55.72981944},
+			{Motor::EfficiencyClass::SPECIFIED, 3560.0, 200.0, 222.5249241},
+			{Motor::EfficiencyClass::SPECIFIED, 3560.0, 1200.0, 1325.577544},
+			{Motor::EfficiencyClass::SPECIFIED, 1780.0, 5.0, 5.945853556},
+			{Motor::EfficiencyClass::SPECIFIED, 1780.0, 50.0, 58.05871742},
+			{Motor::EfficiencyClass::SPECIFIED, 1780.0, 200.0, 228.3902237},
+			{Motor::EfficiencyClass::SPECIFIED, 1780.0, 1200.0, 1335.441966},
+			{Motor::EfficiencyClass::SPECIFIED, 1185.0, 5.0, 6.536776373},
+			{Motor::EfficiencyClass::SPECIFIED, 1185.0, 50.0, 59.68613778},
+			{Motor::EfficiencyClass::SPECIFIED, 1185.0, 200.0, 237.6444941},
+			{Motor::EfficiencyClass::SPECIFIED, 1185.0, 1200.0, 1364.249916},
+			{Motor::EfficiencyClass::SPECIFIED, 880.0, 5.0, 6.959253056},
+			{Motor::EfficiencyClass::SPECIFIED, 880.0, 50.0, 63.32672895},
+			{Motor::EfficiencyClass::SPECIFIED, 880.0, 200.0, 252.1590748},
+			{Motor::EfficiencyClass::SPECIFIED, 880.0, 1200.0, 1467.002287},
+			{Motor::EfficiencyClass::SPECIFIED, 700.0, 5.0, 7.243374784},
+			{Motor::EfficiencyClass::SPECIFIED, 700.0, 50.0, 65.90495063},
+			{Motor::EfficiencyClass::SPECIFIED, 700.0, 200.0, 263.210163},
+			{Motor::EfficiencyClass::SPECIFIED, 700.0, 1200.0, 1518.595347},
+			{Motor::EfficiencyClass::SPECIFIED, 590.0, 5.0, 7.440819225},
+			{Motor::EfficiencyClass::SPECIFIED, 590.0, 50.0, 67.7091954},
+			{Motor::EfficiencyClass::SPECIFIED, 590.0, 200.0, 269.6674098},
+			{Motor::EfficiencyClass::SPECIFIED, 590.0, 1200.0, 1556.387298},
+	};
+
+	std::vector<Motor> motors;
+	for (auto const & e : expected) {
+		motors.emplace_back(Motor::LineFrequency::FREQ60, e.ratedPower, e.rpm, e.efficiencyClass, 94, 460, 0);
+	}
+
+	auto const estimatedFLAs = EstimateFLA::calculate(motors);
+	REQUIRE(estimatedFLAs.size() == motors.size());
+	for (std::size_t i = 0; i < motors.size(); ++i) {
+		auto const & m = motors[i];
+		EstimateFLA estimateFLA(m.motorRatedPower, m.motorRpm, m.lineFrequency, m.efficiencyClass,
+		                        m.specifiedEfficiency, m.motorRatedVoltage);
+		CHECK(estimatedFLAs[i] == estimateFLA.getEstimatedFLA());
+		CHECK(estimatedFLAs[i] == Approx(expected[i].estimatedFLA));
+	}
+}
@@ -0,0 +1,24 @@
+#include <catch.hpp>
+#include <stdexcept>
+#include "calculator/util/SafeguardedNewton.h"
+
+TEST_CASE( "SafeguardedNewton", "[SafeguardedNewton]") {
+    // rising polynomial
+    auto const cubic = [](double x) { return x * x * x - 2 * x - 5; };
+    auto const cubicSlope = [](double x) { return 3 * x * x - 2; };
+    CHECK(SafeguardedNewton(cubic, cubicSlope, 1e-12).calculate(2, 3, cubic(2), cubic(3)) == Approx(2.0945514815));
+
+    // falling piecewise linear, Newton alone overshoots the kink
+    auto const pieces = [](double x) { return x < 1 ? 4 - 3 * x : 1.5 - 0.5 * x; };
+    auto const piecesSlope = [](double x) { return x < 1 ? -3.0 : -0.5; };
+    CHECK(SafeguardedNewton(pieces, piecesSlope, 1e-12).calculate(0, 4, pieces(0), pieces(4)) == Approx(3));
+
+    // roots at the ends of the bracket
+    CHECK(SafeguardedNewton(cubic, cubicSlope, 1e-12).calculate(2, 3, 0, 1) == Approx(2));
+    CHECK(SafeguardedNewton(cubic, cubicSlope, 1e-12).calculate(2, 3, -1, 0) == Approx(3));
+
+    // sign change without a root
+    auto const step = [](double x) { return x < 0.5 ? -1.0 : 1.0; };
+    auto const flat = [](double) { return 0.0; };
+    CHECK_THROWS_AS(SafeguardedNewton(step, flat, 0).calculate(0, 1, -1, 1), const std::runtime_error &);
+}
@@ -1,4 +1,5 @@
 #include "catch.hpp"
+#include <algorithm>
 #include <ssmt/api/SteamModeler.h>
 
 static const BoilerInput makeBoilerInput() {
@@ -41,11 +42,143 @@ static const SteamModelerInput makeSteamModelerInput() {
     return {isBaselineCalc, baselinePowerDemand, boilerInput, headerInput, operationsInput, turbineInput};
 }
 
+static const SteamModelerInput makeThreeHeaderSteamModelerInput() {
+    const BoilerInput &boilerInput = makeBoilerInput();
+    const HeaderInput headerInput = {HeaderWithHighestPressure(1.136, 22680, 50, 0.1, 338.7, true),
+                                     std::make_shared<HeaderNotHighestPressure>(0.6, 5000, 50, 0.1, true, true, 450),
+                                     std::make_shared<HeaderNotHighestPressure>(0.3, 5000, 50, 0.1, true, false, 0)};
+    const CondensingTurbine condensingTurbine = {65, 98, 0.01, CondensingTurbineOperation::STEAM_FLOW, 1000, false};
+    const PressureTurbine highToLowTurbine = {65, 98, PressureTurbineOperation::FLOW_RANGE, 5000, 11000, true};
+    const PressureTurbine highToMediumTurbine = {65, 98, PressureTurbineOperation::STEAM_FLOW, 8000, 0, true};
+    const PressureTurbine mediumToLowTurbine = {65, 98, PressureTurbineOperation::STEAM_FLOW, 9000, 0, true};
+    const TurbineInput turbineInput = {condensingTurbine, highToLowTurbine, highToMediumTurbine, mediumToLowTurbine};
+
+    return {true, 1, boilerInput, headerInput, makeOperationsInput(), turbineInput};
+}
+
 TEST_CASE("steamModeler", "[steam modeler]") {
     auto steamModeler = SteamModeler();
 
     SteamModelerInput steamModelerInput = makeSteamModelerInput();
     SteamModelerOutput actual = steamModeler.model(steamModelerInput);
 
-    //TODO add asserts
+    CHECK(actual.boiler.getSteamMassFlow() == Approx(26261.30665));
+    CHECK(actual.boiler.getFuelEnergy() == Approx(74634735.11));
+    CHECK(actual.boiler.getFeedwaterProperties().massFlow == Approx(26797.25169));
+
+    const HighPressureHeaderCalculationsDomain &highPressureHeader = actual.highPressureHeaderCalculationsDomain;
+    CHECK(highPressureHeader.highPressureHeaderOutput.massFlow == Approx(26261.30665));
+    CHECK(highPressureHeader.highPressureHeaderOutput.specificEnthalpy == Approx(2914.920955));
+    CHECK(highPressureHeader.highPressureHeaderHeatLoss.getHeatLoss() == Approx(76626.25932));
+
+    const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeader =
+            actual.makeupWaterAndCondensateHeaderCalculationsDomain;
+    CHECK(makeupWaterAndCondensateHeader.makeupWater.massFlow == Approx(11902.74229));
+    CHECK(makeupWaterAndCondensateHeader.makeupWater.specificEnthalpy == Approx(42.11872247));
+    CHECK(makeupWaterAndCondensateHeader.makeupWaterAndCondensateHeaderOutput.massFlow == Approx(23594.76188));
+    CHECK(makeupWaterAndCondensateHeader.makeupWaterAndCondensateHeaderOutput.temperature == Approx(316.3049435));
+
+    CHECK(actual.deaerator.getFeedwaterProperties().massFlow == Approx(26797.25169));
+    CHECK(actual.deaerator.getFeedwaterProperties().specificEnthalpy == Approx(507.8439105));
+    CHECK(actual.deaerator.getInletWaterProperties().massFlow == Approx(23594.76175));
+    CHECK(actual.deaerator.getInletSteamProperties().massFlow == Approx(3229.287182));
+    CHECK(actual.deaerator.getVentedSteamProperties().massFlow == Approx(26.79725169));
+
+    const EnergyAndCostCalculationsDomain &energyAndCost = actual.energyAndCostCalculationsDomain;
+    CHECK(energyAndCost.powerGenerated == Approx(1));
+    CHECK(energyAndCost.boilerFuelCost == Approx(3270792.631));
+    CHECK(energyAndCost.makeupWaterCost == Approx(62865.24202));
+    CHECK(energyAndCost.totalOperatingCost == Approx(5335257.873));
+}
+
+TEST_CASE("steamModelerThreeHeaders", "[steam modeler]") {
+    const SteamModelerOutput actual = SteamModeler().model(makeThreeHeaderSteamModelerInput());
+
+    CHECK(actual.boiler.getSteamMassFlow() == Approx(36001.11025));
+    CHECK(actual.boiler.getFuelEnergy() == Approx(102315294.6));
+    CHECK(actual.boiler.getFeedwaterProperties().massFlow == Approx(36735.82679));
+
+    const HighPressureHeaderCalculationsDomain &highPressureHeader = actual.highPressureHeaderCalculationsDomain;
+    CHECK(highPressureHeader.highPressureHeaderOutput.massFlow == Approx(36001.11025));
+    CHECK(highPressureHeader.highPressureHeaderOutput.specificEnthalpy == Approx(2914.920955));
+    CHECK(highPressureHeader.highPressureHeaderHeatLoss.getHeatLoss() == Approx(105045.4361));
+
+    REQUIRE(actual.mediumPressureHeaderCalculationsDomain != nullptr);
+    const MediumPressureHeaderCalculationsDomain &mediumPressureHeader = *actual.mediumPressureHeaderCalculationsDomain;
+    CHECK(mediumPressureHeader.mediumPressureHeaderOutput.massFlow == Approx(8973.827876));
+    CHECK(mediumPressureHeader.mediumPressureHeaderOutput.specificEnthalpy == Approx(2818.733625));
+    CHECK(mediumPressureHeader.mediumPressureHeaderHeatLoss.getHeatLoss() == Approx(25320.15053));
+
+    REQUIRE(actual.lowPressureHeaderCalculationsDomain != nullptr);
+    const LowPressureHeaderCalculationsDomain &lowPressureHeader = *actual.lowPressureHeaderCalculationsDomain;
+    CHECK(lowPressureHeader.lowPressureHeaderOutput.massFlow == Approx(14742.2967));
+    CHECK(lowPressureHeader.lowPressureHeaderOutput.specificEnthalpy == Approx(2734.173547));
+    CHECK(lowPressureHeader.lowPressureHeaderHeatLoss.getHeatLoss() == Approx(40348.34601));
+
+    const MakeupWaterAndCondensateHeaderCalculationsDomain &makeupWaterAndCondensateHeader =
+            actual.makeupWaterAndCondensateHeaderCalculationsDomain;
+    CHECK(makeupWaterAndCondensateHeader.makeupWater.massFlow == Approx(12008.49513));
+    CHECK(makeupWaterAndCondensateHeader.makeupWater.specificEnthalpy == Approx(42.11872247));
+    CHECK(makeupWaterAndCondensateHeader.makeupWaterAndCondensateHeaderOutput.massFlow == Approx(27046.53604));
+    CHECK(makeupWaterAndCondensateHeader.makeupWaterAndCondensateHeaderOutput.temperature == Approx(316.8065516));
+
+    CHECK(actual.deaerator.getFeedwaterProperties().massFlow == Approx(36752.09692));
+    CHECK(actual.deaerator.getFeedwaterProperties().specificEnthalpy == Approx(507.8439105));
+    CHECK(actual.deaerator.getInletWaterProperties().massFlow == Approx(32072.72389));
+    CHECK(actual.deaerator.getInletSteamProperties().massFlow == Approx(4716.125124));
+    CHECK(actual.deaerator.getVentedSteamProperties().massFlow == Approx(36.75209692));
+
+    const EnergyAndCostCalculationsDomain &energyAndCost = actual.energyAndCostCalculationsDomain;
+    CHECK(energyAndCost.powerGenerated == Approx(2268864.611));
+    CHECK(energyAndCost.boilerFuelCost == Approx(4483865.471));
+    CHECK(energyAndCost.makeupWaterCost == Approx(63423.78375));
+    CHECK(energyAndCost.totalOperatingCost == Approx(6548889.255));
+}
+
+TEST_CASE("steamModelerSteamPropertiesCalculations", "[steam modeler]") {
+    const SteamModelerInput &steamModelerInput = makeSteamModelerInput();
+
+    const unsigned long long before = SteamProperties::getCalculationCount();
+    SteamModeler().model(steamModelerInput);
+    const unsigned long long calculations = SteamProperties::getCalculationCount() - before;
+
+    // the makeup water, makeup water and condensate header and deaerator stages share the states they have in
+    // common, before that this model run took 240 steam properties calculations
+    INFO("SteamProperties calculations per model run: " << calculations);
+    CHECK(calculations <= 200);
+}
+
+TEST_CASE("steamModelerBalanceTrace", "[steam modeler]") {
+    SteamBalanceTrace trace;
+    SteamModeler().model(makeSteamModelerInput(), trace);
+
+    const std::vector<SteamBalanceIteration> &iterations = trace.getIterations();
+    REQUIRE(iterations.size() > 1);
+    CHECK(trace.isBalanced());
+    CHECK(iterations.front().initialMassFlow == Approx(22680));
+    for (std::size_t i = 0; i + 1 < iterations.size(); i++) {
+        CHECK(iterations[i].iteration == static_cast<int>(i) + 1);
+        CHECK_FALSE(iterations[i].balanced);
+        CHECK(iterations[i + 1].initialMassFlow == iterations[i].adjustedInitialSteam);
+        CHECK(iterations[i].adjustedInitialSteam ==
+              Approx(iterations[i].initialMassFlow + iterations[i].additionalSteamNeeded));
+        CHECK(fabs(iterations[i + 1].additionalSteamNeeded) < fabs(iterations[i].additionalSteamNeeded));
+    }
+
+    const std::string &csv = trace.toCsv();
+    CHECK(csv.find("iteration,initialMassFlow,balanced,additionalSteamNeeded,adjustedInitialSteam,reductionBranch\n") == 0);
+    CHECK(static_cast<std::size_t>(std::count(csv.begin(), csv.end(), '\n')) == iterations.size() + 1);
+}
+
+TEST_CASE("steamModelerBalanceTraceReductionBranch", "[steam modeler]") {
+    const SteamModelerInput &steamModelerInput = makeThreeHeaderSteamModelerInput();
+
+    SteamBalanceTrace trace;
+    SteamModeler().model(steamModelerInput, trace);
+
+    REQUIRE(trace.getIterationCount() > 1);
+    CHECK(trace.isBalanced());
+    const SteamBalanceIteration &first = trace.getIterations().front();
+    CHECK(first.reductionBranch == SteamReductionBranch::FLOW_RANGE);
+    CHECK(first.additionalSteamNeeded > 0);
 }
@@ -0,0 +1,90 @@
+#include "catch.hpp"
+#include <ssmt/api/SteamModeler.h>
+#include <ssmt/api/SteamModelerCache.h>
+
+static const SteamModelerInput makeSteamModelerInput(const double processSteamUsage, const bool useCondensingTurbine,
+                                                     const double condenserPressure) {
+    const BoilerInput boilerInput = {1, 1, 85, 2, true, true, 514.2, .1, 0.204747, 10};
+    const HeaderInput headerInput = {HeaderWithHighestPressure(1.136, processSteamUsage, 50, 0.1, 338.7, true),
+                                     nullptr, nullptr};
+    const OperationsInput operationsInput = {18000000, 283.15, 8000, 0.000005478, 1.39E-05, 0.66};
+    const CondensingTurbine condensingTurbine = {65, 98, condenserPressure, CondensingTurbineOperation::STEAM_FLOW,
+                                                 1000, useCondensingTurbine};
+    const PressureTurbine pressureTurbine = {65, 98, PressureTurbineOperation::STEAM_FLOW, 1000, 0, false};
+    const TurbineInput turbineInput = {condensingTurbine, pressureTurbine, pressureTurbine, pressureTurbine};
+
+    return {true, 1, boilerInput, headerInput, operationsInput, turbineInput};
+}
+
+TEST_CASE("steamModelerCacheKey", "[steam modeler][cache]") {
+    const SteamModelerCache cache;
+
+    CHECK(cache.makeKey(makeSteamModelerInput(22680, true, 0.01)) ==
+          cache.makeKey(makeSteamModelerInput(22680, true, 0.01)));
+    CHECK(cache.makeKey(makeSteamModelerInput(22680, true, 0.01)) !=
+          cache.makeKey(makeSteamModelerInput(22680, true, 0.02)));
+    CHECK(cache.makeKey(makeSteamModelerInput(22680, true, 0.01)) !=
+          cache.makeKey(makeSteamModelerInput(20000, true, 0.01)));
+    // values of turbines that are not in use do not change the key
+    CHECK(cache.makeKey(makeSteamModelerInput(22680, false, 0.01)) ==
+          cache.makeKey(makeSteamModelerInput(22680, false, 0.02)));
+}
+
+TEST_CASE("steamModelerCacheLookupAndEviction", "[steam modeler][cache]") {
+    auto steamModeler = SteamModeler();
+    const SteamModelerInput &input1 = makeSteamModelerInput(22680, true, 0.01);
+    const SteamModelerInput &input2 = makeSteamModelerInput(20000, true, 0.01);
+    const SteamModelerOutput &output1 = steamModeler.model(input1);
+    const SteamModelerOutput &output2 = steamModeler.model(input2);
+
+    SteamModelerCache cache(1 << 20);
+    const std::string &key1 = cache.makeKey(input1);
+    const std::string &key2 = cache.makeKey(input2);
+
+    CHECK(cache.find(key1) == nullptr);
+    cache.store(key1, output1);
+    const std::shared_ptr<SteamModelerOutput> &hit = cache.find(key1);
+    REQUIRE(hit != nullptr);
+    CHECK(hit->energyAndCostCalculationsDomain.totalOperatingCost ==
+          output1.energyAndCostCalculationsDomain.totalOperatingCost);
+
+    SteamModelerCache::Statistics statistics = cache.getStatistics();
+    CHECK(statistics.hits == 1);
+    CHECK(statistics.misses == 1);
+    CHECK(statistics.hitRate() == Approx(0.5));
+    CHECK(statistics.entries == 1);
+    const std::size_t entryBytes = statistics.bytesUsed;
+    CHECK(entryBytes > key1.size());
+
+    // a budget for a single result evicts the least recently used one
+    cache.setBudget(entryBytes + entryBytes / 2);
+    cache.store(key2, output2);
+    statistics = cache.getStatistics();
+    CHECK(statistics.entries == 1);
+    CHECK(statistics.evictions == 1);
+    CHECK(statistics.bytesUsed <= statistics.budgetBytes);
+    CHECK(cache.find(key1) == nullptr);
+    CHECK(cache.find(key2) != nullptr);
+
+    cache.setBudget(0);
+    CHECK_FALSE(cache.isEnabled());
+    CHECK(cache.getStatistics().entries == 0);
+}
+
+TEST_CASE("steamModelerUsesProcessCache", "[steam modeler][cache]") {
+    SteamModelerCache &cache = SteamModelerCache::instance();
+    cache.setBudget(1 << 20);
+    const SteamModelerCache::Statistics before = cache.getStatistics();
+
+    auto steamModeler = SteamModeler();
+    const SteamModelerInput &input = makeSteamModelerInput(21000, true, 0.01);
+    const SteamModelerOutput &first = steamModeler.model(input);
+    const SteamModelerOutput &second = steamModeler.model(input);
+
+    const SteamModelerCache::Statistics after = cache.getStatistics();
+    CHECK(after.misses == before.misses + 1);
+    CHECK(after.hits == before.hits + 1);
+    CHECK(second.boiler.getFuelEnergy() == first.boiler.getFuelEnergy());
+
+    cache.setBudget(0);
+}
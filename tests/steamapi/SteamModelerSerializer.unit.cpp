@@ -0,0 +1,82 @@
+#include "catch.hpp"
+#include <ssmt/api/SteamModeler.h>
+#include <ssmt/api/SteamModelerSerializer.h>
+
+static const SteamModelerInput makeThreeHeaderSteamModelerInput() {
+    const BoilerInput boilerInput = {1, 1, 85, 2, true, true, 514.2, .1, 0.204747, 10};
+
+    const HeaderWithHighestPressure highPressureHeader = {1.136, 22680, 50, 0.1, 338.7, true};
+    const std::shared_ptr<HeaderNotHighestPressure> mediumPressureHeader =
+            std::make_shared<HeaderNotHighestPressure>(0.6, 5000, 50, 0.1, true, true, 450);
+    const std::shared_ptr<HeaderNotHighestPressure> lowPressureHeader =
+            std::make_shared<HeaderNotHighestPressure>(0.3, 5000, 50, 0.1, true, false, 0);
+    const HeaderInput headerInput = {highPressureHeader, mediumPressureHeader, lowPressureHeader};
+
+    const OperationsInput operationsInput = {18000000, 283.15, 8000, 0.000005478, 1.39E-05, 0.66};
+
+    const CondensingTurbine condensingTurbine = {65, 98, 0.01, CondensingTurbineOperation::STEAM_FLOW, 1000, true};
+    const PressureTurbine highToLowTurbine = {65, 98, PressureTurbineOperation::STEAM_FLOW, 1000, 0, true};
+    const PressureTurbine highToMediumTurbine = {65, 98, PressureTurbineOperation::STEAM_FLOW, 1000, 0, true};
+    const PressureTurbine mediumToLowTurbine = {65, 98, PressureTurbineOperation::STEAM_FLOW, 1000, 0, false};
+    const TurbineInput turbineInput = {condensingTurbine, highToLowTurbine, highToMediumTurbine, mediumToLowTurbine};
+
+    return {true, 1, boilerInput, headerInput, operationsInput, turbineInput};
+}
+
+TEST_CASE("steamModelerSerializerInputRoundTrip", "[steam modeler][serializer]") {
+    const SteamModelerInput &input = makeThreeHeaderSteamModelerInput();
+    const SteamModelerSerializer serializer;
+
+    const std::string &data = serializer.serialize(input);
+    const SteamModelerInput &actual = serializer.deserializeInput(data);
+
+    CHECK(actual.isBaselineCalc() == input.isBaselineCalc());
+    CHECK(actual.getBoilerInput().getDeaeratorPressure() == input.getBoilerInput().getDeaeratorPressure());
+    CHECK(actual.getBoilerInput().isPreheatMakeupWater() == input.getBoilerInput().isPreheatMakeupWater());
+    CHECK(actual.getHeaderInput().getHeaderCount() == 3);
+    CHECK(actual.getHeaderInput().getHighPressureHeader().getCondensateReturnTemperature() == 338.7);
+    CHECK(actual.getHeaderInput().getMediumPressureHeader()->getDesuperheatSteamTemperature() == 450);
+    CHECK(actual.getHeaderInput().getLowPressureHeader()->getPressure() == 0.3);
+    CHECK(actual.getOperationsInput().getMakeUpWaterCosts() == 0.66);
+    CHECK(actual.getTurbineInput().getCondensingTurbine().getOperationType() == CondensingTurbineOperation::STEAM_FLOW);
+    CHECK(actual.getTurbineInput().getMediumToLowTurbine().isUseTurbine() == false);
+
+    CHECK(serializer.serialize(actual) == data);
+}
+
+TEST_CASE("steamModelerSerializerOutputRoundTrip", "[steam modeler][serializer]") {
+    auto steamModeler = SteamModeler();
+    const SteamModelerOutput &output = steamModeler.model(makeThreeHeaderSteamModelerInput());
+    const SteamModelerSerializer serializer;
+
+    const std::string &data = serializer.serialize(output);
+    const SteamModelerOutput &actual = serializer.deserializeOutput(data);
+
+    CHECK(actual.boiler.getSteamProperties().energyFlow == output.boiler.getSteamProperties().energyFlow);
+    CHECK(actual.boiler.getFuelEnergy() == output.boiler.getFuelEnergy());
+    CHECK(actual.highPressureHeaderCalculationsDomain.highPressureHeaderHeatLoss.getHeatLoss()
+          == output.highPressureHeaderCalculationsDomain.highPressureHeaderHeatLoss.getHeatLoss());
+    CHECK(actual.highPressureHeaderCalculationsDomain.condensingTurbine->getPowerOut()
+          == output.highPressureHeaderCalculationsDomain.condensingTurbine->getPowerOut());
+    REQUIRE(actual.mediumPressureHeaderCalculationsDomain != nullptr);
+    CHECK(actual.mediumPressureHeaderCalculationsDomain->highToMediumPressurePrv->isWithDesuperheating());
+    CHECK(actual.mediumPressureHeaderCalculationsDomain->highToMediumPressurePrv->getOutletMassFlow()
+          == output.mediumPressureHeaderCalculationsDomain->highToMediumPressurePrv->getOutletMassFlow());
+    REQUIRE(actual.lowPressureHeaderCalculationsDomain != nullptr);
+    CHECK_FALSE(actual.lowPressureHeaderCalculationsDomain->lowPressurePrv->isWithDesuperheating());
+    CHECK(actual.deaerator.getFeedwaterProperties().massFlow == output.deaerator.getFeedwaterProperties().massFlow);
+    CHECK(actual.energyAndCostCalculationsDomain.totalOperatingCost
+          == output.energyAndCostCalculationsDomain.totalOperatingCost);
+
+    // every field is restored, so serializing the restored output reproduces the same bytes
+    CHECK(serializer.serialize(actual) == data);
+}
+
+TEST_CASE("steamModelerSerializerRejectsInvalidData", "[steam modeler][serializer]") {
+    const SteamModelerSerializer serializer;
+    const std::string &data = serializer.serialize(makeThreeHeaderSteamModelerInput());
+
+    CHECK_THROWS_AS(serializer.deserializeOutput(data), const std::runtime_error &);
+    CHECK_THROWS_AS(serializer.deserializeInput(data.substr(0, data.size() - 1)), const std::runtime_error &);
+    CHECK_THROWS_AS(serializer.deserializeInput("not a steam model"), const std::runtime_error &);
+}